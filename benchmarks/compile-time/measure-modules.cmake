@@ -0,0 +1,105 @@
+# Copyright 2025 Fred Emmott <fred@fredemmott.com>
+# SPDX-License-Identifier: MIT
+#
+# Compares build times of a multi-TU program using
+# `#include <magic_args/magic_args.hpp>` with the same program using
+# `import magic_args;`.
+#
+# Usage:
+#
+#   cmake
+#     -DCXX_COMPILER=...
+#     -DGENERATOR=...            # must support C++20 modules, e.g. `Ninja`
+#     -DMAGIC_ARGS_SOURCE_DIR=...
+#     -DWORK_DIR=...
+#     [-DRESULTS_FILE=...]
+#     [-DTU_COUNT=16]
+#     [-DJOBS=1]
+#     -P measure-modules.cmake
+cmake_minimum_required(VERSION 3.28)
+
+foreach (VAR CXX_COMPILER GENERATOR MAGIC_ARGS_SOURCE_DIR WORK_DIR)
+  if (NOT DEFINED ${VAR})
+    message(FATAL_ERROR "${VAR} must be defined")
+  endif ()
+endforeach ()
+if (NOT DEFINED TU_COUNT)
+  set(TU_COUNT 16)
+endif ()
+if (NOT DEFINED JOBS)
+  set(JOBS 1)
+endif ()
+
+include("${CMAKE_CURRENT_LIST_DIR}/timing.cmake")
+
+# Runs `COMMAND...`, and sets `${OUT}` to the elapsed milliseconds
+function(timed OUT)
+  microseconds_now(BEGIN)
+  execute_process(
+    COMMAND ${ARGN}
+    RESULT_VARIABLE RESULT
+    OUTPUT_VARIABLE OUTPUT
+    ERROR_VARIABLE OUTPUT
+  )
+  microseconds_now(END)
+  if (NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "`${ARGN}` failed:\n${OUTPUT}")
+  endif ()
+  math(EXPR RET "(${END} - ${BEGIN}) / 1000")
+  set(${OUT} ${RET} PARENT_SCOPE)
+endfunction ()
+
+set(RESULTS "{}")
+string(JSON RESULTS SET "${RESULTS}" translation_units ${TU_COUNT})
+string(JSON RESULTS SET "${RESULTS}" jobs ${JOBS})
+set(REPORT "")
+foreach (VARIANT headers module)
+  set(BUILD_DIR "${WORK_DIR}/${VARIANT}")
+  if (VARIANT STREQUAL "module")
+    set(USE_MODULE ON)
+  else ()
+    set(USE_MODULE OFF)
+  endif ()
+  timed(
+    CONFIGURE_MS
+    "${CMAKE_COMMAND}"
+    -S "${CMAKE_CURRENT_LIST_DIR}/modules"
+    -B "${BUILD_DIR}"
+    -G "${GENERATOR}"
+    "-DCMAKE_CXX_COMPILER=${CXX_COMPILER}"
+    -DCMAKE_BUILD_TYPE=Release
+    "-DMAGIC_ARGS_SOURCE_DIR=${MAGIC_ARGS_SOURCE_DIR}"
+    "-DTU_COUNT=${TU_COUNT}"
+    "-DUSE_MODULE=${USE_MODULE}"
+  )
+  # Includes building the module itself
+  timed(
+    FULL_MS
+    "${CMAKE_COMMAND}" --build "${BUILD_DIR}" --config Release --clean-first
+    --parallel ${JOBS}
+  )
+  # The usual edit-compile cycle: one translation unit changed
+  file(TOUCH "${BUILD_DIR}/tu1.cpp")
+  timed(
+    INCREMENTAL_MS
+    "${CMAKE_COMMAND}" --build "${BUILD_DIR}" --config Release
+    --parallel ${JOBS}
+  )
+
+  set(${VARIANT}_FULL_MS ${FULL_MS})
+  set(${VARIANT}_INCREMENTAL_MS ${INCREMENTAL_MS})
+  string(JSON RESULTS SET "${RESULTS}" ${VARIANT} "{}")
+  string(JSON RESULTS SET "${RESULTS}" ${VARIANT} full_build_milliseconds ${FULL_MS})
+  string(JSON RESULTS SET "${RESULTS}" ${VARIANT} incremental_build_milliseconds ${INCREMENTAL_MS})
+  string(APPEND REPORT "  ${VARIANT}: ${FULL_MS}ms full build, ${INCREMENTAL_MS}ms after changing one file\n")
+endforeach ()
+
+math(EXPR FULL_PERCENT "(${module_FULL_MS} * 100) / (${headers_FULL_MS} + 1)")
+math(EXPR INCREMENTAL_PERCENT "(${module_INCREMENTAL_MS} * 100) / (${headers_INCREMENTAL_MS} + 1)")
+string(JSON RESULTS SET "${RESULTS}" module_full_build_percent ${FULL_PERCENT})
+string(JSON RESULTS SET "${RESULTS}" module_incremental_build_percent ${INCREMENTAL_PERCENT})
+
+if (DEFINED RESULTS_FILE)
+  file(WRITE "${RESULTS_FILE}" "${RESULTS}\n")
+endif ()
+message(STATUS "Build times for ${TU_COUNT} translation units with ${JOBS} job(s):\n${REPORT}With the module, full builds take ${FULL_PERCENT}% and incremental builds take ${INCREMENTAL_PERCENT}% of the time with headers")
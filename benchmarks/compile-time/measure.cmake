@@ -0,0 +1,240 @@
+# Copyright 2025 Fred Emmott <fred@fredemmott.com>
+# SPDX-License-Identifier: MIT
+#
+# Measures the compile time and object size of generated argument structs,
+# and checks them against a budget.
+#
+# Usage:
+#
+#   cmake
+#     -DCXX_COMPILER=...
+#     -DCXX_COMPILER_ID=...      # e.g. `GNU`, `Clang`, `MSVC`
+#     -DCXX_COMPILER_VERSION=...
+#     -DCXX_FLAGS=...            # optional, a ;-list
+#     -DINCLUDE_DIR=...          # the directory containing `magic_args/`
+#     -DWORK_DIR=...
+#     -DBUDGET_FILE=...
+#     -DRESULTS_FILE=...
+#     [-DREFERENCE_FILE=...]     # defaults to the previous `RESULTS_FILE`
+#     [-DREPEAT=3]
+#     -P measure.cmake
+#
+# Compile times are relative to the `baseline` case in the budget, which only
+# includes the header, so that they are comparable between machines; this
+# includes the cost of the first argument struct.
+#
+# Object sizes are relative to `object_size_baseline`, and are also compared
+# to the same case in `REFERENCE_FILE`, if it exists and is for the same
+# compiler. `RESULTS_FILE` is only written if the budget is met, so by default,
+# object sizes may not grow by more than `max_object_growth_percent` since the
+# last successful run; delete `RESULTS_FILE` to accept an increase.
+cmake_minimum_required(VERSION 3.23)
+
+foreach (VAR CXX_COMPILER CXX_COMPILER_ID INCLUDE_DIR WORK_DIR BUDGET_FILE RESULTS_FILE)
+  if (NOT DEFINED ${VAR})
+    message(FATAL_ERROR "${VAR} must be defined")
+  endif ()
+endforeach ()
+if (NOT DEFINED REPEAT)
+  set(REPEAT 3)
+endif ()
+
+include("${CMAKE_CURRENT_LIST_DIR}/timing.cmake")
+
+file(READ "${BUDGET_FILE}" BUDGET)
+file(MAKE_DIRECTORY "${WORK_DIR}")
+if (NOT DEFINED REFERENCE_FILE)
+  set(REFERENCE_FILE "${RESULTS_FILE}")
+endif ()
+set(REFERENCE "")
+if (EXISTS "${REFERENCE_FILE}")
+  file(READ "${REFERENCE_FILE}" REFERENCE)
+  string(JSON REFERENCE_COMPILER GET "${REFERENCE}" compiler)
+  if (NOT REFERENCE_COMPILER STREQUAL "${CXX_COMPILER_ID} ${CXX_COMPILER_VERSION}")
+    message(STATUS "Ignoring ${REFERENCE_FILE}, as it is for ${REFERENCE_COMPILER}")
+    set(REFERENCE "")
+  endif ()
+endif ()
+
+# Member types cycle through the common kinds of argument
+set(MEMBER_TYPES
+  "std::string mMember@I@"
+  "int mMember@I@ {}"
+  "bool mMember@I@ {false}"
+  "magic_args::option<std::string> mMember@I@ {.mHelp = \"Member @I@\"}"
+)
+list(LENGTH MEMBER_TYPES MEMBER_TYPE_COUNT)
+
+# Writes `${NAME}.cpp`, containing `CLI_COUNT` CLIs that each have an
+# argument struct with `MEMBER_COUNT` members; if `CLI_COUNT` is 0, it only
+# includes the header. `DEFINES` are defined before the include, e.g.
+# `MAGIC_ARGS_DISABLE_STREAM_CONVERSIONS`.
+function(generate_source NAME CLI_COUNT MEMBER_COUNT DEFINES)
+  set(SOURCE "// Generated by measure.cmake\n")
+  foreach (DEFINE ${DEFINES})
+    string(APPEND SOURCE "#define ${DEFINE}\n")
+  endforeach ()
+  string(APPEND SOURCE "#include <magic_args/magic_args.hpp>\n\nnamespace compile_time {\n")
+  if (CLI_COUNT EQUAL 0)
+    set(CLIS)
+  else ()
+    set(CLIS RANGE 1 ${CLI_COUNT})
+  endif ()
+  foreach (CLI ${CLIS})
+    string(APPEND SOURCE "\nstruct Args${CLI} {\n")
+    foreach (I RANGE 1 ${MEMBER_COUNT})
+      math(EXPR TYPE_INDEX "(${I} - 1) % ${MEMBER_TYPE_COUNT}")
+      list(GET MEMBER_TYPES ${TYPE_INDEX} MEMBER)
+      string(REPLACE "@I@" "${I}" MEMBER "${MEMBER}")
+      string(APPEND SOURCE "  ${MEMBER};\n")
+    endforeach ()
+    string(APPEND SOURCE "};\n\nint main${CLI}(int argc, char** argv) {\n  const auto args = magic_args::parse<Args${CLI}>(argc, argv);\n  if (!args) {\n    return 1;\n  }\n  magic_args::dump(*args);\n  return 0;\n}\n")
+  endforeach ()
+  string(APPEND SOURCE "\n}// namespace compile_time\n")
+  file(WRITE "${WORK_DIR}/${NAME}.cpp" "${SOURCE}")
+endfunction ()
+
+# Compiles `${NAME}.cpp` `REPEAT` times, and sets `${NAME}_MS` to the fastest
+# time, and `${NAME}_BYTES` to the object size
+function(measure NAME)
+  set(SOURCE "${WORK_DIR}/${NAME}.cpp")
+  if (CXX_COMPILER_ID STREQUAL "MSVC")
+    set(OBJECT "${WORK_DIR}/${NAME}.obj")
+    set(COMMAND "${CXX_COMPILER}" /nologo /std:c++latest /EHsc /utf-8 /O2 ${CXX_FLAGS} "/I${INCLUDE_DIR}" /c "${SOURCE}" "/Fo${OBJECT}")
+  else ()
+    set(OBJECT "${WORK_DIR}/${NAME}.o")
+    set(COMMAND "${CXX_COMPILER}" -std=c++23 -O2 ${CXX_FLAGS} "-I${INCLUDE_DIR}" -c "${SOURCE}" -o "${OBJECT}")
+    if (CXX_COMPILER_ID MATCHES "Clang")
+      # Writes `${NAME}.json` next to the object, for chrome://tracing or
+      # https://ui.perfetto.dev
+      list(APPEND COMMAND -ftime-trace)
+    endif ()
+  endif ()
+
+  set(BEST "")
+  foreach (RUN RANGE 1 ${REPEAT})
+    microseconds_now(BEGIN)
+    execute_process(
+      COMMAND ${COMMAND}
+      RESULT_VARIABLE RESULT
+      OUTPUT_VARIABLE OUTPUT
+      ERROR_VARIABLE OUTPUT
+    )
+    microseconds_now(END)
+    if (NOT RESULT EQUAL 0)
+      message(FATAL_ERROR "Failed to compile ${SOURCE}:\n${OUTPUT}")
+    endif ()
+    math(EXPR ELAPSED "(${END} - ${BEGIN}) / 1000")
+    if (BEST STREQUAL "" OR ELAPSED LESS BEST)
+      set(BEST ${ELAPSED})
+    endif ()
+  endforeach ()
+  file(SIZE "${OBJECT}" BYTES)
+  set(${NAME}_MS ${BEST} PARENT_SCOPE)
+  set(${NAME}_BYTES ${BYTES} PARENT_SCOPE)
+endfunction ()
+
+string(JSON CASE_COUNT LENGTH "${BUDGET}" cases)
+math(EXPR LAST_CASE "${CASE_COUNT} - 1")
+string(JSON BASELINE GET "${BUDGET}" baseline)
+string(JSON SIZE_BASELINE GET "${BUDGET}" object_size_baseline)
+string(JSON MAX_GROWTH_PERCENT GET "${BUDGET}" max_object_growth_percent)
+
+set(NAMES)
+foreach (INDEX RANGE ${LAST_CASE})
+  string(JSON NAME GET "${BUDGET}" cases ${INDEX} name)
+  string(JSON CLI_COUNT GET "${BUDGET}" cases ${INDEX} clis)
+  string(JSON MEMBER_COUNT GET "${BUDGET}" cases ${INDEX} members)
+  # Optional
+  set(DEFINES)
+  string(JSON DEFINE_COUNT ERROR_VARIABLE NO_DEFINES LENGTH "${BUDGET}" cases ${INDEX} defines)
+  if (NOT NO_DEFINES AND DEFINE_COUNT GREATER 0)
+    math(EXPR LAST_DEFINE "${DEFINE_COUNT} - 1")
+    foreach (DEFINE_INDEX RANGE ${LAST_DEFINE})
+      string(JSON DEFINE GET "${BUDGET}" cases ${INDEX} defines ${DEFINE_INDEX})
+      list(APPEND DEFINES "${DEFINE}")
+    endforeach ()
+  endif ()
+  generate_source("${NAME}" ${CLI_COUNT} ${MEMBER_COUNT} "${DEFINES}")
+  measure("${NAME}")
+  list(APPEND NAMES "${NAME}")
+endforeach ()
+
+# Sets `${OUT}` to `VALUE` as a percentage of `BASE`, rounding down
+function(percent OUT VALUE BASE)
+  if (BASE LESS 1)
+    set(BASE 1)
+  endif ()
+  math(EXPR RET "(${VALUE} * 100) / ${BASE}")
+  set(${OUT} ${RET} PARENT_SCOPE)
+endfunction ()
+
+# Sets `${OUT}` to the object size of `NAME` in `REFERENCE`, or an empty
+# string if it is not there
+function(reference_bytes OUT NAME)
+  set(RET "")
+  if (NOT REFERENCE STREQUAL "")
+    string(JSON COUNT LENGTH "${REFERENCE}" cases)
+    math(EXPR LAST "${COUNT} - 1")
+    foreach (INDEX RANGE ${LAST})
+      string(JSON CASE_NAME GET "${REFERENCE}" cases ${INDEX} name)
+      if (CASE_NAME STREQUAL NAME)
+        string(JSON RET GET "${REFERENCE}" cases ${INDEX} object_bytes)
+      endif ()
+    endforeach ()
+  endif ()
+  set(${OUT} "${RET}" PARENT_SCOPE)
+endfunction ()
+
+set(RESULTS "{}")
+string(JSON RESULTS SET "${RESULTS}" compiler "\"${CXX_COMPILER_ID} ${CXX_COMPILER_VERSION}\"")
+string(JSON RESULTS SET "${RESULTS}" baseline "\"${BASELINE}\"")
+string(JSON RESULTS SET "${RESULTS}" object_size_baseline "\"${SIZE_BASELINE}\"")
+string(JSON RESULTS SET "${RESULTS}" cases "[]")
+set(FAILURES)
+set(REPORT "")
+foreach (INDEX RANGE ${LAST_CASE})
+  list(GET NAMES ${INDEX} NAME)
+  set(MS ${${NAME}_MS})
+  set(BYTES ${${NAME}_BYTES})
+  percent(TIME_PERCENT ${MS} ${${BASELINE}_MS})
+  percent(SIZE_PERCENT ${BYTES} ${${SIZE_BASELINE}_BYTES})
+  string(JSON MAX_TIME_PERCENT GET "${BUDGET}" cases ${INDEX} max_time_percent)
+  string(JSON MAX_SIZE_PERCENT GET "${BUDGET}" cases ${INDEX} max_object_size_percent)
+
+  set(CASE "{}")
+  string(JSON CASE SET "${CASE}" name "\"${NAME}\"")
+  string(JSON CASE SET "${CASE}" milliseconds ${MS})
+  string(JSON CASE SET "${CASE}" object_bytes ${BYTES})
+  string(JSON CASE SET "${CASE}" time_percent ${TIME_PERCENT})
+  string(JSON CASE SET "${CASE}" object_size_percent ${SIZE_PERCENT})
+  string(JSON RESULTS SET "${RESULTS}" cases ${INDEX} "${CASE}")
+
+  string(APPEND REPORT "  ${NAME}: ${MS}ms (${TIME_PERCENT}%, budget ${MAX_TIME_PERCENT}%), ${BYTES} bytes (${SIZE_PERCENT}%, budget ${MAX_SIZE_PERCENT}%)")
+  if (TIME_PERCENT GREATER MAX_TIME_PERCENT)
+    list(APPEND FAILURES "${NAME}: compile time is ${TIME_PERCENT}% of ${BASELINE}, budget is ${MAX_TIME_PERCENT}%")
+  endif ()
+  if (SIZE_PERCENT GREATER MAX_SIZE_PERCENT)
+    list(APPEND FAILURES "${NAME}: object size is ${SIZE_PERCENT}% of ${SIZE_BASELINE}, budget is ${MAX_SIZE_PERCENT}%")
+  endif ()
+
+  # Catches growth that affects every case equally, including the baselines
+  reference_bytes(PREVIOUS_BYTES "${NAME}")
+  if (NOT PREVIOUS_BYTES STREQUAL "")
+    percent(GROWTH_PERCENT ${BYTES} ${PREVIOUS_BYTES})
+    string(APPEND REPORT ", ${GROWTH_PERCENT}% of reference")
+    math(EXPR MAX_GROWTH "100 + ${MAX_GROWTH_PERCENT}")
+    if (GROWTH_PERCENT GREATER MAX_GROWTH)
+      list(APPEND FAILURES "${NAME}: object size is ${BYTES} bytes, ${GROWTH_PERCENT}% of ${PREVIOUS_BYTES} bytes in ${REFERENCE_FILE}, budget is ${MAX_GROWTH}%")
+    endif ()
+  endif ()
+  string(APPEND REPORT "\n")
+endforeach ()
+
+message(STATUS "Compile-time results for ${CXX_COMPILER_ID} ${CXX_COMPILER_VERSION}; times are relative to ${BASELINE}, and sizes to ${SIZE_BASELINE}:\n${REPORT}")
+if (FAILURES)
+  list(JOIN FAILURES "\n  " FAILURES)
+  message(FATAL_ERROR "Compile-time budget exceeded:\n  ${FAILURES}")
+endif ()
+file(WRITE "${RESULTS_FILE}" "${RESULTS}\n")
+message(STATUS "Written to ${RESULTS_FILE}")
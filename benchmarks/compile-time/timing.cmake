@@ -0,0 +1,11 @@
+# Copyright 2025 Fred Emmott <fred@fredemmott.com>
+# SPDX-License-Identifier: MIT
+#
+# Shared by the compile-time benchmark scripts; requires CMake 3.23 or above
+
+function(microseconds_now OUT)
+  # A single reading; `%f` is the zero-padded 6-digit fraction, so this is the
+  # number of microseconds since the epoch
+  string(TIMESTAMP NOW "%s%f" UTC)
+  set(${OUT} ${NOW} PARENT_SCOPE)
+endfunction ()
@@ -0,0 +1,84 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <magic_args/magic_args.hpp>
+#include <sstream>
+
+namespace {
+
+struct Knobs {
+  int mThreads {0};
+  unsigned int mQueueDepth {0};
+  std::int64_t mMaxBytes {0};
+  double mRatio {0};
+  float mTimeoutSeconds {0};
+  magic_args::option<bool> mVerify;
+  magic_args::optional_positional_argument<std::vector<std::uint32_t>> mIds;
+};
+
+// The conversion used for all non-string values before `std::from_chars()`
+template <class T>
+void stringstream_conversion(T& out, std::string_view arg) {
+  std::stringstream ss {std::string {arg}};
+  ss >> out;
+}
+
+std::vector<std::string_view> knob_args() {
+  std::vector<std::string_view> ret {
+    "benchmark",
+    "--threads=16",
+    "--queue-depth=4096",
+    "--max-bytes=17179869184",
+    "--ratio=0.75",
+    "--timeout-seconds=2.5",
+    "--verify=true",
+  };
+  for (std::size_t i = 0; i < 64; ++i) {
+    ret.emplace_back("123456789");
+  }
+  return ret;
+}
+
+}// namespace
+
+TEST_CASE("integer conversions") {
+  const std::string_view arg {"17179869184"};
+
+  BENCHMARK("std::stringstream") {
+    std::int64_t value {};
+    stringstream_conversion(value, arg);
+    return value;
+  };
+
+  BENCHMARK("from_string_arg_outer") {
+    std::int64_t value {};
+    (void)magic_args::detail::from_string_arg_outer(value, arg);
+    return value;
+  };
+}
+
+TEST_CASE("floating-point conversions") {
+  const std::string_view arg {"0.125"};
+
+  BENCHMARK("std::stringstream") {
+    double value {};
+    stringstream_conversion(value, arg);
+    return value;
+  };
+
+  BENCHMARK("from_string_arg_outer") {
+    double value {};
+    (void)magic_args::detail::from_string_arg_outer(value, arg);
+    return value;
+  };
+}
+
+TEST_CASE("parse numeric options") {
+  auto args = knob_args();
+  REQUIRE(magic_args::parse<Knobs>(args).has_value());
+
+  BENCHMARK("magic_args::parse") {
+    return magic_args::parse<Knobs>(args);
+  };
+}
@@ -0,0 +1,344 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <magic_args/magic_args.hpp>
+
+#include <cstdio>
+#include <deque>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Deterministic inputs for the benchmarks, so that results are comparable
+// between runs and machines
+namespace magic_args_benchmarks {
+
+// Options are `mOption1` to `mOptionN`; odd options are strings, even options
+// are integers
+struct Members1 {
+  std::string mOption1;
+};
+
+struct Members4 {
+  std::string mOption1;
+  int mOption2 {};
+  std::string mOption3;
+  int mOption4 {};
+};
+
+struct Members8 {
+  std::string mOption1;
+  int mOption2 {};
+  std::string mOption3;
+  int mOption4 {};
+  std::string mOption5;
+  int mOption6 {};
+  std::string mOption7;
+  int mOption8 {};
+};
+
+struct Members16 {
+  std::string mOption1;
+  int mOption2 {};
+  std::string mOption3;
+  int mOption4 {};
+  std::string mOption5;
+  int mOption6 {};
+  std::string mOption7;
+  int mOption8 {};
+  std::string mOption9;
+  int mOption10 {};
+  std::string mOption11;
+  int mOption12 {};
+  std::string mOption13;
+  int mOption14 {};
+  std::string mOption15;
+  int mOption16 {};
+};
+
+struct Members64 {
+  std::string mOption1;
+  int mOption2 {};
+  std::string mOption3;
+  int mOption4 {};
+  std::string mOption5;
+  int mOption6 {};
+  std::string mOption7;
+  int mOption8 {};
+  std::string mOption9;
+  int mOption10 {};
+  std::string mOption11;
+  int mOption12 {};
+  std::string mOption13;
+  int mOption14 {};
+  std::string mOption15;
+  int mOption16 {};
+  std::string mOption17;
+  int mOption18 {};
+  std::string mOption19;
+  int mOption20 {};
+  std::string mOption21;
+  int mOption22 {};
+  std::string mOption23;
+  int mOption24 {};
+  std::string mOption25;
+  int mOption26 {};
+  std::string mOption27;
+  int mOption28 {};
+  std::string mOption29;
+  int mOption30 {};
+  std::string mOption31;
+  int mOption32 {};
+  std::string mOption33;
+  int mOption34 {};
+  std::string mOption35;
+  int mOption36 {};
+  std::string mOption37;
+  int mOption38 {};
+  std::string mOption39;
+  int mOption40 {};
+  std::string mOption41;
+  int mOption42 {};
+  std::string mOption43;
+  int mOption44 {};
+  std::string mOption45;
+  int mOption46 {};
+  std::string mOption47;
+  int mOption48 {};
+  std::string mOption49;
+  int mOption50 {};
+  std::string mOption51;
+  int mOption52 {};
+  std::string mOption53;
+  int mOption54 {};
+  std::string mOption55;
+  int mOption56 {};
+  std::string mOption57;
+  int mOption58 {};
+  std::string mOption59;
+  int mOption60 {};
+  std::string mOption61;
+  int mOption62 {};
+  std::string mOption63;
+  int mOption64 {};
+};
+
+struct Members128 {
+  std::string mOption1;
+  int mOption2 {};
+  std::string mOption3;
+  int mOption4 {};
+  std::string mOption5;
+  int mOption6 {};
+  std::string mOption7;
+  int mOption8 {};
+  std::string mOption9;
+  int mOption10 {};
+  std::string mOption11;
+  int mOption12 {};
+  std::string mOption13;
+  int mOption14 {};
+  std::string mOption15;
+  int mOption16 {};
+  std::string mOption17;
+  int mOption18 {};
+  std::string mOption19;
+  int mOption20 {};
+  std::string mOption21;
+  int mOption22 {};
+  std::string mOption23;
+  int mOption24 {};
+  std::string mOption25;
+  int mOption26 {};
+  std::string mOption27;
+  int mOption28 {};
+  std::string mOption29;
+  int mOption30 {};
+  std::string mOption31;
+  int mOption32 {};
+  std::string mOption33;
+  int mOption34 {};
+  std::string mOption35;
+  int mOption36 {};
+  std::string mOption37;
+  int mOption38 {};
+  std::string mOption39;
+  int mOption40 {};
+  std::string mOption41;
+  int mOption42 {};
+  std::string mOption43;
+  int mOption44 {};
+  std::string mOption45;
+  int mOption46 {};
+  std::string mOption47;
+  int mOption48 {};
+  std::string mOption49;
+  int mOption50 {};
+  std::string mOption51;
+  int mOption52 {};
+  std::string mOption53;
+  int mOption54 {};
+  std::string mOption55;
+  int mOption56 {};
+  std::string mOption57;
+  int mOption58 {};
+  std::string mOption59;
+  int mOption60 {};
+  std::string mOption61;
+  int mOption62 {};
+  std::string mOption63;
+  int mOption64 {};
+  std::string mOption65;
+  int mOption66 {};
+  std::string mOption67;
+  int mOption68 {};
+  std::string mOption69;
+  int mOption70 {};
+  std::string mOption71;
+  int mOption72 {};
+  std::string mOption73;
+  int mOption74 {};
+  std::string mOption75;
+  int mOption76 {};
+  std::string mOption77;
+  int mOption78 {};
+  std::string mOption79;
+  int mOption80 {};
+  std::string mOption81;
+  int mOption82 {};
+  std::string mOption83;
+  int mOption84 {};
+  std::string mOption85;
+  int mOption86 {};
+  std::string mOption87;
+  int mOption88 {};
+  std::string mOption89;
+  int mOption90 {};
+  std::string mOption91;
+  int mOption92 {};
+  std::string mOption93;
+  int mOption94 {};
+  std::string mOption95;
+  int mOption96 {};
+  std::string mOption97;
+  int mOption98 {};
+  std::string mOption99;
+  int mOption100 {};
+  std::string mOption101;
+  int mOption102 {};
+  std::string mOption103;
+  int mOption104 {};
+  std::string mOption105;
+  int mOption106 {};
+  std::string mOption107;
+  int mOption108 {};
+  std::string mOption109;
+  int mOption110 {};
+  std::string mOption111;
+  int mOption112 {};
+  std::string mOption113;
+  int mOption114 {};
+  std::string mOption115;
+  int mOption116 {};
+  std::string mOption117;
+  int mOption118 {};
+  std::string mOption119;
+  int mOption120 {};
+  std::string mOption121;
+  int mOption122 {};
+  std::string mOption123;
+  int mOption124 {};
+  std::string mOption125;
+  int mOption126 {};
+  std::string mOption127;
+  int mOption128 {};
+};
+
+// Similar to `xargs my_tool --level=3 -o out.txt`
+struct Files {
+  bool mVerbose {false};
+  int mLevel {0};
+  magic_args::option<std::string> mOutput {.mShortName = "o"};
+  magic_args::optional_positional_argument<std::vector<std::string>> mInputs;
+};
+
+struct FilesLazy {
+  bool mVerbose {false};
+  int mLevel {0};
+  magic_args::option<std::string> mOutput {.mShortName = "o"};
+  magic_args::optional_positional_argument<
+    magic_args::positional_argument_range<std::string_view>>
+    mInputs;
+};
+
+// Owns the strings that `mArgs` refers to
+struct corpus {
+  std::deque<std::string> mStorage;
+  std::vector<std::string_view> mArgs;
+
+  void push_back(std::string arg) {
+    mArgs.emplace_back(mStorage.emplace_back(std::move(arg)));
+  }
+
+  // A mutable copy, e.g. for `getopt_long()`, which reorders `argv`
+  std::vector<char*> argv() const {
+    std::vector<char*> ret;
+    ret.reserve(mStorage.size() + 1);
+    for (auto&& arg: mStorage) {
+      ret.push_back(const_cast<char*>(arg.c_str()));
+    }
+    ret.push_back(nullptr);
+    return ret;
+  }
+};
+
+// Every option in `MembersN`, e.g. `--option1=1`
+template <class Traits>
+corpus options(std::size_t count) {
+  corpus ret;
+  ret.push_back("benchmark");
+  for (std::size_t i = 1; i <= count; ++i) {
+    std::string name = std::format("mOption{}", i);
+    Traits::normalize_option_name(name);
+    ret.push_back(std::format(
+      "{}{}{}{}", Traits::long_arg_prefix, name, Traits::value_separator, i));
+  }
+  return ret;
+}
+
+// `count` paths for `Files`; if `interleaved`, options are mixed with the
+// positional arguments
+inline corpus files(std::size_t count, bool interleaved) {
+  corpus ret;
+  ret.push_back("benchmark");
+  if (!interleaved) {
+    ret.push_back("--verbose");
+    ret.push_back("--level=3");
+    ret.push_back("-o");
+    ret.push_back("out.txt");
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    ret.push_back(std::format("/srv/data/shard-{:07}/input.bin", i));
+    if (interleaved && i == count / 2) {
+      ret.push_back("--verbose");
+      ret.push_back("--level=3");
+      ret.push_back("-o");
+      ret.push_back("out.txt");
+    }
+  }
+  return ret;
+}
+
+// Where to write usage and `dump()` output
+inline FILE* null_output() {
+#ifdef _WIN32
+  static FILE* const ret = std::fopen("NUL", "w");
+#else
+  static FILE* const ret = std::fopen("/dev/null", "w");
+#endif
+  return ret;
+}
+
+}// namespace magic_args_benchmarks
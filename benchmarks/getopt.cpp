@@ -0,0 +1,142 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+
+// Baselines using `getopt_long()`, for platforms that have it
+#if __has_include(<getopt.h>)
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <getopt.h>
+
+#include <charconv>
+
+#include "corpus.hpp"
+
+using namespace magic_args_benchmarks;
+
+namespace {
+
+void reset_getopt() {
+#ifdef __GLIBC__
+  optind = 0;
+#else
+  optreset = 1;
+  optind = 1;
+#endif
+}
+
+int to_int(const char* arg) {
+  int ret {};
+  const std::string_view view {arg};
+  std::from_chars(view.data(), view.data() + view.size(), ret);
+  return ret;
+}
+
+// Equivalent to `Members16`
+struct GetoptMembers {
+  std::string mStrings[8];
+  int mInts[8] {};
+};
+
+GetoptMembers parse_members(
+  std::vector<char*> argv,
+  const std::vector<option>& longOptions) {
+  GetoptMembers ret;
+  reset_getopt();
+  int index {};
+  while (getopt_long(
+           static_cast<int>(argv.size() - 1),
+           argv.data(),
+           "",
+           longOptions.data(),
+           &index)
+         == 0) {
+    if (index % 2 == 0) {
+      ret.mStrings[index / 2] = optarg;
+    } else {
+      ret.mInts[index / 2] = to_int(optarg);
+    }
+  }
+  return ret;
+}
+
+// Equivalent to `Files`
+struct GetoptFiles {
+  bool mVerbose {false};
+  int mLevel {0};
+  std::string mOutput;
+  std::vector<std::string> mInputs;
+};
+
+GetoptFiles parse_files(std::vector<char*> argv) {
+  static const option longOptions[] {
+    {"verbose", no_argument, nullptr, 'v'},
+    {"level", required_argument, nullptr, 'l'},
+    {"output", required_argument, nullptr, 'o'},
+    {},
+  };
+  GetoptFiles ret;
+  reset_getopt();
+  const auto argc = static_cast<int>(argv.size() - 1);
+  int c {};
+  while ((c = getopt_long(argc, argv.data(), "o:", longOptions, nullptr))
+         != -1) {
+    switch (c) {
+      case 'v':
+        ret.mVerbose = true;
+        break;
+      case 'l':
+        ret.mLevel = to_int(optarg);
+        break;
+      case 'o':
+        ret.mOutput = optarg;
+        break;
+      default:
+        break;
+    }
+  }
+  ret.mInputs.reserve(argc - optind);
+  for (int i = optind; i < argc; ++i) {
+    ret.mInputs.emplace_back(argv[i]);
+  }
+  return ret;
+}
+
+}// namespace
+
+TEST_CASE("struct size, getopt_long", "[parse][getopt]") {
+  std::vector<std::string> names;
+  std::vector<option> longOptions;
+  for (std::size_t i = 1; i <= 16; ++i) {
+    names.push_back(std::format("option{}", i));
+  }
+  for (auto&& name: names) {
+    longOptions.push_back({name.c_str(), required_argument, nullptr, 0});
+  }
+  longOptions.push_back({});
+
+  const auto corpus = options<magic_args::gnu_style_parsing_traits>(16);
+  const auto argv = corpus.argv();
+  const auto parsed = parse_members(argv, longOptions);
+  REQUIRE(parsed.mStrings[7] == "15");
+  REQUIRE(parsed.mInts[7] == 16);
+
+  // Includes copying `argv`, as `getopt_long()` reorders it
+  BENCHMARK("16 members") {
+    return parse_members(argv, longOptions);
+  };
+}
+
+TEST_CASE("argument count, getopt_long", "[parse][getopt]") {
+  for (const std::size_t count: {1, 100, 10'000, 1'000'000}) {
+    const auto corpus = files(count, false);
+    const auto argv = corpus.argv();
+    const auto parsed = parse_files(argv);
+    REQUIRE(parsed.mLevel == 3);
+    REQUIRE(parsed.mInputs.size() == count);
+
+    BENCHMARK(std::format("{} arguments", corpus.mArgs.size())) {
+      return parse_files(argv);
+    };
+  }
+}
+#endif
@@ -0,0 +1,192 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "corpus.hpp"
+
+using namespace magic_args_benchmarks;
+
+namespace {
+
+template <class T, class Traits>
+void benchmark_options(std::string_view name, std::size_t count) {
+  const auto corpus = options<Traits>(count);
+  const auto parsed
+    = magic_args::parse<T, Traits>(corpus.mArgs, {}, null_output());
+  REQUIRE(parsed.has_value());
+
+  BENCHMARK(std::string {name}) {
+    return magic_args::parse<T, Traits>(corpus.mArgs, {}, null_output());
+  };
+}
+
+template <class T>
+void benchmark_files(std::size_t count, bool interleaved) {
+  const auto corpus = files(count, interleaved);
+  const auto parsed = magic_args::parse<T>(corpus.mArgs);
+  REQUIRE(parsed.has_value());
+  REQUIRE(parsed->mInputs.mValue.size() == count);
+
+  BENCHMARK(std::format("{} arguments", corpus.mArgs.size())) {
+    return magic_args::parse<T>(corpus.mArgs);
+  };
+}
+
+}// namespace
+
+TEMPLATE_TEST_CASE(
+  "struct size",
+  "[parse]",
+  magic_args::gnu_style_parsing_traits,
+  magic_args::powershell_style_parsing_traits) {
+  benchmark_options<Members1, TestType>("1 member", 1);
+  benchmark_options<Members4, TestType>("4 members", 4);
+  benchmark_options<Members8, TestType>("8 members", 8);
+  benchmark_options<Members16, TestType>("16 members", 16);
+  benchmark_options<Members64, TestType>("64 members", 64);
+  benchmark_options<Members128, TestType>("128 members", 128);
+}
+
+TEST_CASE("argument count, std::vector", "[parse]") {
+  for (const std::size_t count: {1, 100, 10'000, 1'000'000}) {
+    benchmark_files<Files>(count, false);
+  }
+}
+
+TEST_CASE("argument count, positional_argument_range", "[parse]") {
+  for (const std::size_t count: {1, 100, 10'000, 1'000'000}) {
+    benchmark_files<FilesLazy>(count, false);
+  }
+}
+
+TEST_CASE("argument count, options between positional arguments", "[parse]") {
+  for (const std::size_t count: {1, 100, 10'000, 1'000'000}) {
+    benchmark_files<FilesLazy>(count, true);
+  }
+}
+
+// The lengths of C strings, e.g. `argv`, are measured each time an argument is
+// read, rather than copied into a `std::string_view` up front
+TEST_CASE("argument types", "[parse]") {
+  const auto options = magic_args_benchmarks::options<
+    magic_args::gnu_style_parsing_traits>(16);
+  const auto optionsArgv = options.argv();
+  const auto files = magic_args_benchmarks::files(10'000, false);
+  const auto filesArgv = files.argv();
+  const auto argc = [](const std::vector<char*>& argv) {
+    // Excluding the trailing `nullptr`
+    return static_cast<int>(argv.size() - 1);
+  };
+  REQUIRE(magic_args::parse<Members16>(argc(optionsArgv), optionsArgv.data())
+            .has_value());
+  REQUIRE(magic_args::parse<FilesLazy>(argc(filesArgv), filesArgv.data())
+            .has_value());
+
+  BENCHMARK("std::string_view, 16 members") {
+    return magic_args::parse<Members16>(options.mArgs);
+  };
+  BENCHMARK("argv, 16 members") {
+    return magic_args::parse<Members16>(
+      argc(optionsArgv), optionsArgv.data());
+  };
+  BENCHMARK("std::string_view, 10005 arguments") {
+    return magic_args::parse<FilesLazy>(files.mArgs);
+  };
+  BENCHMARK("argv, 10005 arguments") {
+    return magic_args::parse<FilesLazy>(argc(filesArgv), filesArgv.data());
+  };
+}
+
+TEMPLATE_TEST_CASE(
+  "usage",
+  "[usage]",
+  magic_args::gnu_style_parsing_traits,
+  magic_args::powershell_style_parsing_traits) {
+  corpus corpus;
+  corpus.push_back("benchmark");
+  corpus.push_back(
+    std::format("{}{}", TestType::long_arg_prefix, TestType::long_help_arg));
+  REQUIRE(
+    magic_args::parse<Members16, TestType>(corpus.mArgs, {}, null_output())
+      .error()
+    == magic_args::HelpRequested);
+
+  BENCHMARK("16 members") {
+    return magic_args::parse<Members16, TestType>(
+      corpus.mArgs, {}, null_output());
+  };
+}
+
+TEST_CASE("reusable parser", "[parse][usage]") {
+  const magic_args::parser<Members16> parser;
+  const auto args = options<magic_args::gnu_style_parsing_traits>(16);
+  REQUIRE(parser.parse(args.mArgs, null_output()).has_value());
+
+  BENCHMARK("16 members") {
+    return parser.parse(args.mArgs, null_output());
+  };
+
+  Members16 reused;
+  BENCHMARK("parse_into, 16 members") {
+    return parser.parse_into(reused, args.mArgs, null_output());
+  };
+
+  corpus help;
+  help.push_back("benchmark");
+  help.push_back("--help");
+  REQUIRE(
+    parser.parse(help.mArgs, null_output()).error()
+    == magic_args::HelpRequested);
+
+  BENCHMARK("usage, 16 members") {
+    return parser.parse(help.mArgs, null_output());
+  };
+}
+
+TEST_CASE("parse_into", "[parse]") {
+  // Too long for the small-string optimization
+  corpus corpus;
+  corpus.push_back("benchmark");
+  for (std::size_t i = 1; i <= 16; ++i) {
+    if (i % 2) {
+      corpus.push_back(
+        std::format("--option{}=/srv/data/shard-{:07}/input.bin", i, i));
+    } else {
+      corpus.push_back(std::format("--option{}={}", i, i));
+    }
+  }
+  Members16 reused;
+  REQUIRE(magic_args::parse_into(reused, corpus.mArgs).has_value());
+
+  BENCHMARK("parse(), 16 members") {
+    return magic_args::parse<Members16>(corpus.mArgs);
+  };
+  BENCHMARK("parse_into(), 16 members") {
+    return magic_args::parse_into(reused, corpus.mArgs);
+  };
+
+  // Each path is too long for the small-string optimization; `parse_into()`
+  // assigns to the existing elements of `mInputs`
+  const auto paths = files(1000, false);
+  Files reusedFiles;
+  REQUIRE(magic_args::parse_into(reusedFiles, paths.mArgs).has_value());
+
+  BENCHMARK("parse(), 1000 paths") {
+    return magic_args::parse<Files>(paths.mArgs);
+  };
+  BENCHMARK("parse_into(), 1000 paths") {
+    return magic_args::parse_into(reusedFiles, paths.mArgs);
+  };
+}
+
+TEST_CASE("dump", "[dump]") {
+  const auto corpus = options<magic_args::gnu_style_parsing_traits>(16);
+  const auto parsed = magic_args::parse<Members16>(corpus.mArgs);
+  REQUIRE(parsed.has_value());
+
+  BENCHMARK("16 members") {
+    magic_args::dump(*parsed, null_output());
+  };
+}
@@ -0,0 +1,99 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <magic_args/magic_args.hpp>
+#include <format>
+
+namespace {
+
+// Similar to `xargs my_tool -o out.txt`
+struct ManyFiles {
+  bool mVerbose {false};
+  magic_args::mandatory_positional_argument<std::string> mOutput;
+  magic_args::optional_positional_argument<std::string> mMode;
+  magic_args::optional_positional_argument<std::vector<std::string>> mInputs;
+};
+
+struct ManyFilesLazy {
+  bool mVerbose {false};
+  magic_args::mandatory_positional_argument<std::string> mOutput;
+  magic_args::optional_positional_argument<std::string> mMode;
+  magic_args::optional_positional_argument<
+    magic_args::positional_argument_range<std::string>>
+    mInputs;
+};
+
+constexpr std::size_t FileCount = 100'000;
+
+struct Arguments {
+  std::vector<std::string> mStorage;
+  std::vector<std::string_view> mArgs;
+};
+
+Arguments many_files(const bool withSeparator) {
+  Arguments ret;
+  ret.mStorage.reserve(FileCount);
+  for (std::size_t i = 0; i < FileCount; ++i) {
+    ret.mStorage.push_back(std::format("/srv/data/shard-{:06}/input.bin", i));
+  }
+  ret.mArgs.reserve(FileCount + 5);
+  ret.mArgs.emplace_back("benchmark");
+  ret.mArgs.emplace_back("--verbose");
+  if (withSeparator) {
+    ret.mArgs.emplace_back("--");
+  }
+  ret.mArgs.emplace_back("out.txt");
+  ret.mArgs.emplace_back("append");
+  ret.mArgs.insert(
+    ret.mArgs.end(), ret.mStorage.begin(), ret.mStorage.end());
+  return ret;
+}
+
+}// namespace
+
+TEST_CASE("100k positional arguments") {
+  auto [storage, args] = many_files(false);
+  const auto parsed = magic_args::parse<ManyFiles>(args);
+  REQUIRE(parsed.has_value());
+  REQUIRE(parsed->mInputs.mValue.size() == FileCount);
+
+  BENCHMARK("magic_args::parse") {
+    return magic_args::parse<ManyFiles>(args);
+  };
+}
+
+TEST_CASE("100k positional arguments after --") {
+  auto [storage, args] = many_files(true);
+  const auto parsed = magic_args::parse<ManyFiles>(args);
+  REQUIRE(parsed.has_value());
+  REQUIRE(parsed->mInputs.mValue.size() == FileCount);
+
+  BENCHMARK("magic_args::parse") {
+    return magic_args::parse<ManyFiles>(args);
+  };
+}
+
+TEST_CASE("100k positional arguments, positional_argument_range") {
+  auto [storage, args] = many_files(false);
+  const auto parsed = magic_args::parse<ManyFilesLazy>(args);
+  REQUIRE(parsed.has_value());
+  REQUIRE(parsed->mInputs.mValue.size() == FileCount);
+
+  BENCHMARK("magic_args::parse") {
+    return magic_args::parse<ManyFilesLazy>(args);
+  };
+}
+
+TEST_CASE("100k positional arguments, strict_utf8") {
+  using Traits
+    = magic_args::strict_utf8<magic_args::gnu_style_parsing_traits>;
+  auto [storage, args] = many_files(false);
+  const auto parsed = magic_args::parse<ManyFilesLazy, Traits>(args);
+  REQUIRE(parsed.has_value());
+  REQUIRE(parsed->mInputs.mValue.size() == FileCount);
+
+  BENCHMARK("magic_args::parse") {
+    return magic_args::parse<ManyFilesLazy, Traits>(args);
+  };
+}
@@ -0,0 +1,74 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <magic_args/magic_args.hpp>
+
+namespace {
+
+struct WideFiles {
+  bool mVerbose {false};
+  magic_args::optional_positional_argument<
+    magic_args::positional_argument_range<std::string_view>>
+    mInputs;
+};
+
+constexpr std::size_t FileCount = 100'000;
+
+std::vector<std::u16string> wide_files(std::u16string_view name) {
+  std::vector<std::u16string> ret;
+  ret.reserve(FileCount + 2);
+  ret.emplace_back(u"benchmark");
+  ret.emplace_back(u"--verbose");
+  for (std::size_t i = 0; i < FileCount; ++i) {
+    ret.emplace_back(std::u16string {u"/srv/data/shard-"}.append(name));
+  }
+  return ret;
+}
+
+std::size_t transcode(
+  const std::vector<std::u16string>& args,
+  std::string& buffer,
+  const bool simd) {
+  std::size_t ret = 0;
+  for (auto&& arg: args) {
+    const std::u16string_view view {arg};
+    const auto written = simd
+      ? magic_args::detail::utf8_from_wide(view, buffer.data())
+      : magic_args::detail::utf8_from_wide_scalar(view, buffer.data());
+    ret += written.value();
+  }
+  return ret;
+}
+
+}// namespace
+
+TEST_CASE("100k UTF-16 arguments") {
+  const auto args = wide_files(u"000123/input.bin");
+  const auto parsed = magic_args::parse<WideFiles>(args);
+  REQUIRE(parsed.has_value());
+  REQUIRE(parsed->mInputs.mValue.size() == FileCount);
+
+  BENCHMARK("magic_args::parse") {
+    return magic_args::parse<WideFiles>(args);
+  };
+}
+
+TEST_CASE("UTF-16 to UTF-8") {
+  const auto ascii = wide_files(u"000123/input.bin");
+  const auto mixed = wide_files(u"000123/dzień-dobry-€.bin");
+  std::string buffer(1024, '\0');
+
+  BENCHMARK("ASCII, scalar") {
+    return transcode(ascii, buffer, false);
+  };
+  BENCHMARK("ASCII, SIMD") {
+    return transcode(ascii, buffer, true);
+  };
+  BENCHMARK("mixed, scalar") {
+    return transcode(mixed, buffer, false);
+  };
+  BENCHMARK("mixed, SIMD") {
+    return transcode(mixed, buffer, true);
+  };
+}
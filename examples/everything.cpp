@@ -17,6 +17,10 @@ std::string formattable_argument_value(const MyCustomType& value) {
 
 struct MyArgs {
   bool mFlag {false};
+  counted_flag mVerbose {
+    .mHelp = "Print more output; can be repeated, e.g. -vvv",
+    .mShortName = "v",
+  };
   std::string mString;
   option<std::string> mWithDocs {
     .mHelp = "Here's some help",
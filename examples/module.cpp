@@ -0,0 +1,29 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdlib>
+#include <string>
+
+import magic_args;
+
+struct MyArgs {
+  bool mFoo {false};
+  std::string mBar;
+  magic_args::option<int> mBaz {.mShortName = "b"};
+};
+
+static_assert(magic_args::basic_option<decltype(MyArgs::mBaz)>);
+static_assert(magic_args::basic_argument<
+              magic_args::optional_positional_argument<std::string>>);
+
+int main(int argc, char** argv) {
+  const auto args = magic_args::parse<MyArgs>(argc, argv);
+  if (!args.has_value()) {
+    if (args.error() == magic_args::HelpRequested) {
+      return EXIT_SUCCESS;
+    }
+    return EXIT_FAILURE;
+  }
+  magic_args::dump(*args);
+  return EXIT_SUCCESS;
+}
@@ -169,6 +169,33 @@ struct flag final {
   bool operator==(const flag&) const noexcept = default;
 };
 
+// A flag that can be specified more than once, e.g. `-vvv` for a verbosity
+// level of 3
+struct counted_flag final {
+  using value_type = std::size_t;
+  std::string mName;
+  std::string mHelp;
+  std::string mShortName;
+  std::size_t mValue {0};
+
+  counted_flag& operator=(std::size_t value) {
+    mValue = value;
+    return *this;
+  }
+  operator std::size_t() const noexcept {
+    return mValue;
+  }
+
+  bool operator==(const counted_flag&) const noexcept = default;
+};
+
 static_assert(basic_option<flag>);
+static_assert(basic_option<counted_flag>);
 static_assert(basic_option<option<std::string>>);
-}// namespace magic_args::inline api
\ No newline at end of file
+}// namespace magic_args::inline api
+
+namespace magic_args::detail {
+// Options that never take a value
+template <class T>
+concept flag_like = std::same_as<T, flag> || std::same_as<T, counted_flag>;
+}// namespace magic_args::detail
\ No newline at end of file
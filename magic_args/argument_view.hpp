@@ -0,0 +1,229 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace magic_args::inline public_api {
+
+// A non-owning view of the arguments passed to `parse()`.
+//
+// Arguments can be contiguous arrays of `std::string_view`, `std::string`, or
+// C strings, e.g. `argv`; they are not copied, and the lengths of C strings
+// are not measured until they are needed.
+class argument_view {
+ private:
+  enum class kind {
+    StringView,
+    String,
+    CString,
+  };
+
+  template <class T>
+  static constexpr bool argument_type = std::same_as<T, std::string_view>
+    || std::same_as<T, std::string> || std::same_as<T, const char*>
+    || std::same_as<T, char*>;
+
+  template <class T>
+  static constexpr kind kind_of = std::same_as<T, std::string_view>
+    ? kind::StringView
+    : (std::same_as<T, std::string> ? kind::String : kind::CString);
+
+ public:
+  class iterator {
+   public:
+    // Values are returned by value, so this is only an input iterator as far
+    // as pre-C++20 algorithms are concerned
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::string_view;
+
+    iterator() = default;
+
+    std::string_view operator*() const noexcept {
+      return at(mData, mKind, mIndex);
+    }
+
+    std::string_view operator[](difference_type n) const noexcept {
+      return at(mData, mKind, mIndex + n);
+    }
+
+    iterator& operator++() noexcept {
+      ++mIndex;
+      return *this;
+    }
+
+    iterator operator++(int) noexcept {
+      auto ret = *this;
+      ++mIndex;
+      return ret;
+    }
+
+    iterator& operator--() noexcept {
+      --mIndex;
+      return *this;
+    }
+
+    iterator operator--(int) noexcept {
+      auto ret = *this;
+      --mIndex;
+      return ret;
+    }
+
+    iterator& operator+=(difference_type n) noexcept {
+      mIndex += n;
+      return *this;
+    }
+
+    iterator& operator-=(difference_type n) noexcept {
+      mIndex -= n;
+      return *this;
+    }
+
+    friend iterator operator+(iterator it, difference_type n) noexcept {
+      return it += n;
+    }
+
+    friend iterator operator+(difference_type n, iterator it) noexcept {
+      return it += n;
+    }
+
+    friend iterator operator-(iterator it, difference_type n) noexcept {
+      return it -= n;
+    }
+
+    friend difference_type operator-(
+      const iterator& a,
+      const iterator& b) noexcept {
+      return static_cast<difference_type>(a.mIndex)
+        - static_cast<difference_type>(b.mIndex);
+    }
+
+    bool operator==(const iterator& other) const noexcept {
+      return mIndex == other.mIndex;
+    }
+
+    auto operator<=>(const iterator& other) const noexcept {
+      return mIndex <=> other.mIndex;
+    }
+
+   private:
+    friend class argument_view;
+    const void* mData {nullptr};
+    kind mKind {kind::StringView};
+    std::size_t mIndex {0};
+
+    iterator(const void* data, kind argKind, std::size_t index)
+      : mData(data), mKind(argKind), mIndex(index) {
+    }
+  };
+
+  argument_view() = default;
+
+  // Any contiguous range of one of the supported types, e.g.
+  // `std::span<char*>` for `argv`, or `std::vector<std::string>`
+  template <std::ranges::contiguous_range R>
+    requires std::ranges::sized_range<R>
+    && argument_type<std::ranges::range_value_t<R>>
+  argument_view(R&& args) noexcept
+    : mData(std::ranges::data(args)),
+      mSize(std::ranges::size(args)),
+      mKind(kind_of<std::ranges::range_value_t<R>>) {
+  }
+
+  [[nodiscard]]
+  std::string_view operator[](std::size_t index) const noexcept {
+    return at(mData, mKind, index);
+  }
+
+  [[nodiscard]]
+  std::size_t size() const noexcept {
+    return mSize;
+  }
+
+  [[nodiscard]]
+  bool empty() const noexcept {
+    return mSize == 0;
+  }
+
+  [[nodiscard]]
+  std::string_view front() const noexcept {
+    return (*this)[0];
+  }
+
+  [[nodiscard]]
+  iterator begin() const noexcept {
+    return {mData, mKind, 0};
+  }
+
+  [[nodiscard]]
+  iterator end() const noexcept {
+    return {mData, mKind, mSize};
+  }
+
+  // Like `std::span::subspan()`
+  [[nodiscard]]
+  argument_view subspan(
+    std::size_t offset,
+    std::size_t count = std::dynamic_extent) const noexcept {
+    auto ret = *this;
+    ret.mData = static_cast<const std::byte*>(mData) + (offset * stride());
+    ret.mSize = (count == std::dynamic_extent) ? (mSize - offset) : count;
+    return ret;
+  }
+
+  // True if both views are of the same arguments
+  bool operator==(const argument_view& other) const noexcept = default;
+
+ private:
+  const void* mData {nullptr};
+  std::size_t mSize {0};
+  kind mKind {kind::StringView};
+
+  [[nodiscard]]
+  static std::string_view
+  at(const void* data, kind argKind, std::size_t index) noexcept {
+    switch (argKind) {
+      case kind::StringView:
+        return static_cast<const std::string_view*>(data)[index];
+      case kind::String:
+        return static_cast<const std::string*>(data)[index];
+      case kind::CString:
+        return static_cast<const char* const*>(data)[index];
+    }
+    return {};
+  }
+
+  [[nodiscard]]
+  std::size_t stride() const noexcept {
+    switch (mKind) {
+      case kind::StringView:
+        return sizeof(std::string_view);
+      case kind::String:
+        return sizeof(std::string);
+      case kind::CString:
+        return sizeof(const char*);
+    }
+    return 0;
+  }
+};
+
+}// namespace magic_args::inline public_api
+
+// Iterators do not refer to the view itself
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<
+  magic_args::public_api::argument_view>
+  = true;
+
+static_assert(std::ranges::random_access_range<magic_args::argument_view>);
+static_assert(std::ranges::sized_range<magic_args::argument_view>);
@@ -0,0 +1,170 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace magic_args::detail {
+
+constexpr bool is_command_line_space(char c) noexcept {
+  return c == ' ' || c == '\t';
+}
+
+}// namespace magic_args::detail
+
+namespace magic_args::inline public_api {
+
+// A Windows-style command line, split into arguments as
+// `CommandLineToArgvW()` does, e.g. `GetCommandLineW()` converted to UTF-8.
+//
+// All arguments are unescaped into a single buffer, and this is a contiguous
+// range of `std::string_view`s referring to it, so it can be passed to
+// `parse()`. Moving this does not invalidate the views.
+//
+// Unlike `CommandLineToArgvW()`, an empty command line has no arguments,
+// rather than the path of the current executable.
+class command_line_arguments {
+ public:
+  command_line_arguments() = default;
+
+  explicit command_line_arguments(std::string_view commandLine) {
+    if (commandLine.empty()) {
+      return;
+    }
+    // Unescaping never makes an argument longer
+    mBuffer = std::make_unique_for_overwrite<char[]>(commandLine.size());
+    mArgs.reserve(max_argument_count(commandLine));
+
+    const auto text = commandLine;
+    const auto n = text.size();
+    char* out = mBuffer.get();
+    std::size_t i = 0;
+
+    // The program name: backslashes are not special, and if it is quoted, it
+    // ends at the next quote
+    const char* begin = out;
+    if (text.front() == '"') {
+      for (i = 1; i < n && text[i] != '"'; ++i) {
+        *out++ = text[i];
+      }
+      if (i < n) {
+        ++i;
+      }
+    } else {
+      for (; i < n && !detail::is_command_line_space(text[i]); ++i) {
+        *out++ = text[i];
+      }
+    }
+    mArgs.emplace_back(begin, out - begin);
+
+    const auto skipSpaces = [&] {
+      while (i < n && detail::is_command_line_space(text[i])) {
+        ++i;
+      }
+    };
+    skipSpaces();
+
+    while (i < n) {
+      begin = out;
+      std::size_t backslashes = 0;
+      // 1 if in a quoted section; briefly 2 or 3 while counting quotes
+      std::size_t quotes = 0;
+      while (i < n) {
+        const auto c = text[i];
+        if (detail::is_command_line_space(c) && quotes == 0) {
+          break;
+        }
+        if (c == '\\') {
+          *out++ = c;
+          ++backslashes;
+          ++i;
+          continue;
+        }
+        if (c != '"') {
+          *out++ = c;
+          backslashes = 0;
+          ++i;
+          continue;
+        }
+
+        if (backslashes % 2 == 0) {
+          // 2n backslashes + `"`: n backslashes, then a quote toggle
+          out -= backslashes / 2;
+          ++quotes;
+        } else {
+          // 2n + 1 backslashes + `"`: n backslashes, then a literal `"`
+          out -= (backslashes / 2) + 1;
+          *out++ = '"';
+        }
+        backslashes = 0;
+        ++i;
+        // Every third consecutive quote is literal, and ends the quoted
+        // section
+        for (; i < n && text[i] == '"'; ++i) {
+          if (++quotes == 3) {
+            *out++ = '"';
+            quotes = 0;
+          }
+        }
+        if (quotes == 2) {
+          quotes = 0;
+        }
+      }
+      mArgs.emplace_back(begin, out - begin);
+      skipSpaces();
+    }
+  }
+
+  [[nodiscard]]
+  const std::string_view* data() const noexcept {
+    return mArgs.data();
+  }
+
+  [[nodiscard]]
+  std::size_t size() const noexcept {
+    return mArgs.size();
+  }
+
+  [[nodiscard]]
+  bool empty() const noexcept {
+    return mArgs.empty();
+  }
+
+  [[nodiscard]]
+  const std::string_view* begin() const noexcept {
+    return mArgs.data();
+  }
+
+  [[nodiscard]]
+  const std::string_view* end() const noexcept {
+    return mArgs.data() + mArgs.size();
+  }
+
+  [[nodiscard]]
+  std::string_view operator[](std::size_t index) const noexcept {
+    return mArgs[index];
+  }
+
+ private:
+  std::unique_ptr<char[]> mBuffer;
+  std::vector<std::string_view> mArgs;
+
+  // Each argument starts after whitespace, plus an empty program name if
+  // the command line starts with whitespace
+  static std::size_t max_argument_count(std::string_view text) noexcept {
+    std::size_t ret = 2;
+    for (std::size_t i = 1; i < text.size(); ++i) {
+      if (
+        detail::is_command_line_space(text[i - 1])
+        && !detail::is_command_line_space(text[i])) {
+        ++ret;
+      }
+    }
+    return ret;
+  }
+};
+
+}// namespace magic_args::inline public_api
@@ -0,0 +1,114 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include <magic_args/argument_view.hpp>
+#include <magic_args/incomplete_parse_reason.hpp>
+
+#include "conversions.hpp"
+#endif
+
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+
+namespace magic_args::detail {
+
+// The parts of `Traits` that are needed at runtime.
+//
+// Optional strings are empty if `Traits` does not have them.
+struct parsing_style {
+  std::string_view mLongArgPrefix;
+  std::string_view mShortArgPrefix;
+  std::string_view mValueSeparator;
+
+  std::string_view mLongHelpArg;
+  std::string_view mShortHelpArg;
+  std::string_view mVersionArg;
+
+  bool mAllowUnambiguousPrefixes {false};
+  bool mValidateUtf8 {false};
+};
+
+template <class Traits>
+constexpr parsing_style make_parsing_style() {
+  parsing_style ret {
+    .mLongArgPrefix = Traits::long_arg_prefix,
+    .mValueSeparator = Traits::value_separator,
+    .mLongHelpArg = Traits::long_help_arg,
+    .mVersionArg = Traits::version_arg,
+    .mAllowUnambiguousPrefixes
+    = requires { requires Traits::allow_unambiguous_prefixes; },
+    .mValidateUtf8 = requires { requires Traits::validate_utf8; },
+  };
+  if constexpr (requires { Traits::short_arg_prefix; }) {
+    ret.mShortArgPrefix = Traits::short_arg_prefix;
+    // Short help is only recognized with a short prefix
+    if constexpr (requires { Traits::short_help_arg; }) {
+      ret.mShortHelpArg = Traits::short_help_arg;
+    }
+  }
+  return ret;
+}
+
+// Where the values for a `positional_argument_range<>` are
+struct positional_argument_storage {
+  // True if the values are in the `args` passed to `parse()`, rather than
+  // a temporary copy
+  bool mInArgs {true};
+  // Keeps `args` alive, if they are not owned by the caller of `parse()`,
+  // e.g. for response files
+  std::shared_ptr<const void> mOwner;
+  // For the temporary copy; if null, the global heap is used
+  std::pmr::memory_resource* mResource {nullptr};
+};
+
+enum class argument_kind {
+  Flag,
+  CountedFlag,
+  Option,
+  MandatoryPositional,
+  OptionalPositional,
+};
+
+// Converts `value` and stores it in the member of `out`, which is a `T*`.
+//
+// `value` is ignored for flags.
+using option_binder_t = from_string_result (*)(
+  void* out,
+  std::string_view value);
+
+// Converts `values` and stores them in the member of `out`, which is a `T*`.
+//
+// `values` has exactly one element, unless the argument takes multiple
+// values. On failure, `invalidValue` is set to the value that could not be
+// converted.
+using positional_binder_t = from_string_result (*)(
+  void* out,
+  argument_view values,
+  const positional_argument_storage& storage,
+  std::string_view& invalidValue);
+
+// Everything that the parser needs to know about a member, without the type.
+//
+// Strings refer to `get_argument_definitions<T, Traits>()`.
+struct argument_descriptor {
+  std::string_view mName;
+  std::string_view mHelp;
+  std::string_view mShortName;
+  argument_kind mKind {};
+  // Only for positional arguments
+  bool mMultipleValues {false};
+
+  option_binder_t mBindOption {nullptr};
+  positional_binder_t mBindPositional {nullptr};
+
+  [[nodiscard]]
+  constexpr bool is_option() const noexcept {
+    return mKind == argument_kind::Flag || mKind == argument_kind::CountedFlag
+      || mKind == argument_kind::Option;
+  }
+};
+
+}// namespace magic_args::detail
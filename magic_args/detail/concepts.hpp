@@ -24,10 +24,32 @@ concept basic_option = requires(T v) {
 }// namespace magic_args::inline api
 
 namespace magic_args::detail {
+// Any `std::basic_string`, including `std::pmr::string`
+template <class T>
+concept std_string = requires {
+  typename T::value_type;
+  typename T::traits_type;
+  typename T::allocator_type;
+} && std::same_as<
+  T,
+  std::basic_string<
+    typename T::value_type,
+    typename T::traits_type,
+    typename T::allocator_type>>;
+
 template <class T>
 concept vector_like = requires { typename T::value_type; }
   && requires(T c, typename T::value_type v) { c.push_back(v); }
-  && (!std::same_as<T, std::string>);
+  && (!std_string<T>);
+
+// `positional_argument_range<T>`
+template <class T>
+concept argument_range
+  = requires { requires T::is_positional_argument_range; };
+
+// Positional arguments that consume all remaining values
+template <class T>
+concept multiple_values = vector_like<T> || argument_range<T>;
 
 template <class T>
 concept std_optional = requires { typename T::value_type; }
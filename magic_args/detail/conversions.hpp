@@ -0,0 +1,243 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include <magic_args/incomplete_parse_reason.hpp>
+
+#include "concepts.hpp"
+#endif
+
+#include <cerrno>
+#include <charconv>
+#include <concepts>
+#include <cstdlib>
+#include <expected>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+// Floating-point `std::from_chars()` is not available everywhere;
+// `__cpp_lib_to_chars` is only defined if it is. The fallback uses the
+// `strto*_l()` functions with the "C" locale.
+#ifndef __cpp_lib_to_chars
+#include <locale.h>
+#if defined(__APPLE__)
+#include <xlocale.h>
+#endif
+#endif
+
+// Define `MAGIC_ARGS_DISABLE_STREAM_CONVERSIONS` to avoid `<sstream>`, which
+// is one of the most expensive standard headers; it is only needed for types
+// without a built-in conversion or `from_string_argument()`
+#ifndef MAGIC_ARGS_DISABLE_STREAM_CONVERSIONS
+#include <sstream>
+#endif
+
+namespace magic_args::detail {
+
+using from_string_result = std::expected<void, incomplete_parse_reason>;
+
+template <class T>
+concept character = std::same_as<T, char> || std::same_as<T, wchar_t>
+  || std::same_as<T, char8_t> || std::same_as<T, char16_t>
+  || std::same_as<T, char32_t>;
+
+template <class T>
+concept numeric_argument
+  = (std::integral<T> && !character<T> && !std::same_as<T, bool>)
+  || std::floating_point<T>;
+
+// `std::pmr::string` is not `std::assignable_from` a `std::string`, as there
+// is no common reference type
+template <class T>
+concept string_conversion
+  = std_string<T> || std::assignable_from<T&, std::string>;
+
+// Types with a built-in conversion, rather than the stream fallback
+template <class T>
+concept builtin_conversion = numeric_argument<T> || std::same_as<T, bool>
+  || std::same_as<T, char>;
+
+#ifndef __cpp_lib_to_chars
+#ifdef _WIN32
+inline _locale_t c_locale() noexcept {
+  static const auto ret = _create_locale(LC_ALL, "C");
+  return ret;
+}
+#else
+inline locale_t c_locale() noexcept {
+  static const auto ret = newlocale(LC_ALL_MASK, "C", locale_t {});
+  return ret;
+}
+#endif
+
+// Accepts the same syntax as `std::from_chars()`: `strto*()` would also skip
+// leading whitespace, and accept hexadecimal
+template <std::floating_point T>
+from_string_result from_chars_fallback(T& out, std::string_view arg) {
+  using enum incomplete_parse_reason;
+  const auto unsigned_arg = arg.substr(arg.starts_with('-') ? 1 : 0);
+  if (
+    unsigned_arg.empty()
+    || std::string_view {" \t\n\v\f\r"}.contains(unsigned_arg.front())
+    || unsigned_arg.starts_with("0x") || unsigned_arg.starts_with("0X")) {
+    return std::unexpected {InvalidArgumentValue};
+  }
+
+  // Unlike `std::from_chars()`, these need a null-terminated string
+  const std::string buffer {arg};
+  const auto first = buffer.c_str();
+  char* last {nullptr};
+  errno = 0;
+#ifdef _WIN32
+  if constexpr (std::same_as<T, float>) {
+    out = _strtof_l(first, &last, c_locale());
+  } else if constexpr (std::same_as<T, double>) {
+    out = _strtod_l(first, &last, c_locale());
+  } else {
+    out = _strtold_l(first, &last, c_locale());
+  }
+#else
+  if constexpr (std::same_as<T, float>) {
+    out = strtof_l(first, &last, c_locale());
+  } else if constexpr (std::same_as<T, double>) {
+    out = strtod_l(first, &last, c_locale());
+  } else {
+    out = strtold_l(first, &last, c_locale());
+  }
+#endif
+  if (errno == ERANGE || last != first + buffer.size()) {
+    return std::unexpected {InvalidArgumentValue};
+  }
+  return {};
+}
+#endif
+
+// The whole argument must be a valid value, without overflow; unlike
+// `std::stringstream`, this does not depend on the locale.
+template <numeric_argument T>
+from_string_result from_string_arg_outer(T& out, std::string_view arg) {
+  using enum incomplete_parse_reason;
+  // `std::from_chars()` does not accept a leading `+`
+  if (arg.starts_with('+')) {
+    arg.remove_prefix(1);
+    if (arg.starts_with('-')) {
+      return std::unexpected {InvalidArgumentValue};
+    }
+  }
+  if (arg.empty()) {
+    return std::unexpected {InvalidArgumentValue};
+  }
+
+  T value {};
+#ifndef __cpp_lib_to_chars
+  if constexpr (std::floating_point<T>) {
+    if (const auto result = from_chars_fallback(value, arg); !result) {
+      return result;
+    }
+    out = value;
+    return {};
+  } else
+#endif
+  {
+    const auto last = arg.data() + arg.size();
+    const auto [ptr, ec] = std::from_chars(arg.data(), last, value);
+    if (ec != std::errc {} || ptr != last) {
+      return std::unexpected {InvalidArgumentValue};
+    }
+    out = value;
+    return {};
+  }
+}
+
+template <std::same_as<bool> T>
+from_string_result from_string_arg_outer(T& out, std::string_view arg) {
+  if (arg == "1" || arg == "true") {
+    out = true;
+    return {};
+  }
+  if (arg == "0" || arg == "false") {
+    out = false;
+    return {};
+  }
+  return std::unexpected {incomplete_parse_reason::InvalidArgumentValue};
+}
+
+template <std::same_as<char> T>
+from_string_result from_string_arg_outer(T& out, std::string_view arg) {
+  if (arg.size() != 1) {
+    return std::unexpected {incomplete_parse_reason::InvalidArgumentValue};
+  }
+  out = arg.front();
+  return {};
+}
+
+// `from_string_argument()` can return void, or a `from_string_result` to
+// report invalid values
+template <class T>
+from_string_result from_string_arg_outer(T& out, std::string_view arg)
+  requires requires { from_string_argument(out, arg); }
+{
+  using TResult = decltype(from_string_argument(out, arg));
+  if constexpr (std::convertible_to<TResult, from_string_result>) {
+    return from_string_argument(out, arg);
+  } else {
+    from_string_argument(out, arg);
+    return {};
+  }
+}
+
+#ifndef MAGIC_ARGS_DISABLE_STREAM_CONVERSIONS
+template <class T>
+from_string_result from_string_arg_outer(T& out, std::string_view arg)
+  requires(!string_conversion<T>) && (!builtin_conversion<T>)
+  && (!requires { from_string_argument(out, arg); })
+  && requires(std::stringstream ss, T v) { ss >> v; }
+{
+  std::stringstream ss {std::string {arg}};
+  if (!(ss >> out)) {
+    return std::unexpected {incomplete_parse_reason::InvalidArgumentValue};
+  }
+  return {};
+}
+#endif
+
+// Refers to the argument, rather than a temporary `std::string`; this is
+// only valid while the arguments are, so the entry points that copy the
+// arguments reject it with `has_argument_views<T>()`
+template <std::same_as<std::string_view> T>
+from_string_result from_string_arg_outer(T& out, std::string_view arg) {
+  out = arg;
+  return {};
+}
+
+template <class T>
+  requires string_conversion<T> && (!std::same_as<T, std::string_view>)
+from_string_result from_string_arg_outer(T& out, std::string_view arg) {
+  // Reuses the existing capacity, e.g. with `parse_into()`
+  if constexpr (requires { out.assign(arg.data(), arg.size()); }) {
+    out.assign(arg.data(), arg.size());
+  } else {
+    out = std::string {arg};
+  }
+  return {};
+}
+
+template <class T>
+  requires requires(T v, std::string_view arg) {
+    from_string_arg_outer(v, arg);
+  }
+from_string_result from_string_arg_outer(
+  std::optional<T>& out,
+  std::string_view arg) {
+  T value {};
+  if (const auto result = from_string_arg_outer(value, arg); !result) {
+    return result;
+  }
+  out = std::move(value);
+  return {};
+}
+
+}// namespace magic_args::detail
@@ -0,0 +1,58 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+namespace magic_args::detail {
+
+template <std::size_t I, class T>
+struct flat_tuple_leaf {
+  T mValue;
+};
+
+template <class Indices, class... Ts>
+struct flat_tuple_base;
+
+template <std::size_t... I, class... Ts>
+struct flat_tuple_base<std::index_sequence<I...>, Ts...>
+  : flat_tuple_leaf<I, Ts>... {};
+
+// A minimal tuple for the members of argument structs.
+//
+// Every element is a direct base, so `get<I>()` is a single overload
+// resolution instead of a walk through `I` levels of recursive inheritance;
+// for large structs, this substantially reduces compile times compared to
+// `std::tuple`.
+template <class... Ts>
+struct flat_tuple : flat_tuple_base<std::index_sequence_for<Ts...>, Ts...> {
+  static constexpr std::size_t size = sizeof...(Ts);
+};
+
+template <class... Ts>
+constexpr flat_tuple<Ts&...> flat_tie(Ts&... values) {
+  return {{{values}...}};
+}
+
+template <class... Ts>
+constexpr flat_tuple<Ts...> make_flat_tuple(Ts... values) {
+  return {{{std::move(values)}...}};
+}
+
+template <std::size_t I, class T>
+constexpr T& get(flat_tuple_leaf<I, T>& leaf) noexcept {
+  return leaf.mValue;
+}
+
+template <std::size_t I, class T>
+constexpr const T& get(const flat_tuple_leaf<I, T>& leaf) noexcept {
+  return leaf.mValue;
+}
+
+template <std::size_t I, class T>
+constexpr T&& get(flat_tuple_leaf<I, T>&& leaf) noexcept {
+  return std::forward<T>(leaf.mValue);
+}
+
+}// namespace magic_args::detail
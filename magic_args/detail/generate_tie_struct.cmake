@@ -0,0 +1,94 @@
+# Copyright 2025 Fred Emmott <fred@fredemmott.com>
+# SPDX-License-Identifier: MIT
+#
+# Generates `tie_struct.hpp`:
+#
+#   cmake -DMAX_MEMBERS=128 -P generate_tie_struct.cmake
+#
+# This can be removed once structured bindings can introduce a pack (C++26
+# P1061R10) is widely available.
+cmake_minimum_required(VERSION 3.22)
+
+if (NOT DEFINED MAX_MEMBERS)
+  set(MAX_MEMBERS 128)
+endif ()
+if (NOT DEFINED OUTPUT_FILE)
+  set(OUTPUT_FILE "${CMAKE_CURRENT_LIST_DIR}/tie_struct.hpp")
+endif ()
+
+# Appends `${PREFIX}v1, v2, ..., vN${SUFFIX}` to `${OUT}`, wrapped to 80
+# columns with continuation lines indented by `INDENT` spaces
+function(append_bindings OUT COUNT PREFIX SUFFIX INDENT)
+  string(REPEAT " " ${INDENT} CONTINUATION)
+  set(LINE "${PREFIX}")
+  set(RET "")
+  foreach (I RANGE 1 ${COUNT})
+    if (I EQUAL COUNT)
+      set(ITEM "v${I}${SUFFIX}")
+    else ()
+      set(ITEM "v${I},")
+    endif ()
+    string(LENGTH "${LINE} ${ITEM}" LENGTH)
+    if (I EQUAL 1)
+      string(APPEND LINE "${ITEM}")
+    elseif (LENGTH GREATER 80)
+      string(APPEND RET "${LINE}\n")
+      set(LINE "${CONTINUATION}${ITEM}")
+    else ()
+      string(APPEND LINE " ${ITEM}")
+    endif ()
+  endforeach ()
+  set(${OUT} "${${OUT}}${RET}${LINE}\n" PARENT_SCOPE)
+endfunction ()
+
+set(SOURCE [=[
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+// Generated by generate_tie_struct.cmake - DO NOT EDIT
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include "flat_tuple.hpp"
+#endif
+
+#include <cstddef>
+
+namespace magic_args::detail {
+
+// clang-format off
+]=])
+string(APPEND SOURCE "constexpr std::size_t max_tie_struct_members = ${MAX_MEMBERS};\n")
+string(APPEND SOURCE [=[
+
+// `tie_struct_t<N>::tie(v)` returns a `flat_tuple` of references to the `N`
+// members of `v`
+template <std::size_t N>
+struct tie_struct_t;
+
+template <>
+struct tie_struct_t<0> {
+  template <class T>
+  static constexpr auto tie(T&) {
+    return flat_tuple<> {};
+  }
+};
+]=])
+foreach (N RANGE 1 ${MAX_MEMBERS})
+  string(APPEND SOURCE
+    "\ntemplate <>\n"
+    "struct tie_struct_t<${N}> {\n"
+    "  template <class T>\n"
+    "  static constexpr auto tie(T& v) {\n"
+  )
+  append_bindings(SOURCE ${N} "    auto& [" "] = v;" 11)
+  append_bindings(SOURCE ${N} "    return flat_tie(" ");" 6)
+  string(APPEND SOURCE "  }\n};\n")
+endforeach ()
+string(APPEND SOURCE [=[
+// clang-format on
+
+}// namespace magic_args::detail
+]=])
+
+file(WRITE "${OUTPUT_FILE}" "${SOURCE}")
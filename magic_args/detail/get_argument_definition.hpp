@@ -4,24 +4,60 @@
 
 #ifndef MAGIC_ARGS_SINGLE_FILE
 #include <magic_args/argument_definitions.hpp>
+#include "flat_tuple.hpp"
 #include "reflection.hpp"
 #endif
 
 #include <concepts>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 namespace magic_args::detail {
 
+template <class T, std::size_t N>
+using member_value_t
+  = std::decay_t<decltype(get<N>(tie_struct(std::declval<T&>())))>;
+
 template <class T, std::size_t N, class Traits>
-auto infer_argument_definition() {
-  // TODO: put the member name -> thing into the traits
+constexpr std::string normalized_member_name() {
   std::string name {detail::member_name<T, N>};
-  using TValue = std::decay_t<decltype(get<N>(detail::tie_struct(T {})))>;
+  using TValue = member_value_t<T, N>;
   if constexpr (basic_argument<TValue> && !basic_option<TValue>) {
     Traits::normalize_positional_argument_name(name);
   } else {
     Traits::normalize_option_name(name);
   }
+  return name;
+}
+
+// Satisfied if the traits' `normalize_*()` functions are `constexpr`
+template <class T, std::size_t N, class Traits>
+concept constexpr_normalized_member_name = requires {
+  typename std::integral_constant<
+    std::size_t,
+    normalized_member_name<T, N, Traits>().size()>;
+};
+
+template <class T, std::size_t N, class Traits>
+  requires constexpr_normalized_member_name<T, N, Traits>
+constexpr auto inferred_name_storage = make_fixed_string<
+  normalized_member_name<T, N, Traits>().size()>(
+  normalized_member_name<T, N, Traits>());
+
+template <class T, std::size_t N, class Traits>
+std::string inferred_name() {
+  if constexpr (constexpr_normalized_member_name<T, N, Traits>) {
+    return std::string {inferred_name_storage<T, N, Traits>.view()};
+  } else {
+    return normalized_member_name<T, N, Traits>();
+  }
+}
+
+template <class T, std::size_t N, class Traits>
+auto infer_argument_definition() {
+  const auto name = inferred_name<T, N, Traits>();
+  using TValue = member_value_t<T, N>;
 
   if constexpr (std::same_as<TValue, bool>) {
     return flag {
@@ -34,13 +70,12 @@ auto infer_argument_definition() {
   }
 }
 
+// `defaults` is a default-initialized T
 template <class T, std::size_t N, class Traits>
-auto get_argument_definition() {
-  using namespace detail;
-
-  auto value = get<N>(tie_struct(T {}));
-  using TValue = std::decay_t<decltype(value)>;
+auto make_argument_definition(const T& defaults) {
+  using TValue = member_value_t<T, N>;
   if constexpr (basic_argument<TValue>) {
+    auto value = get<N>(tie_struct(defaults));
     if (value.mName.empty()) {
       value.mName = infer_argument_definition<T, N, Traits>().mName;
     }
@@ -49,4 +84,35 @@ auto get_argument_definition() {
     return infer_argument_definition<T, N, Traits>();
   }
 }
-}// namespace magic_args::detail
\ No newline at end of file
+
+template <class T, class Traits>
+auto make_argument_definitions() {
+  // Only construct T once: default member initializers may be expensive
+  const T defaults {};
+  return [&defaults]<std::size_t... I>(std::index_sequence<I...>) {
+    return make_flat_tuple(
+      make_argument_definition<T, I, Traits>(defaults)...);
+  }(std::make_index_sequence<count_members<T>()> {});
+}
+
+template <class T, class Traits>
+using argument_definitions_t = decltype(make_argument_definitions<T, Traits>());
+
+template <class T, std::size_t N, class Traits>
+using argument_definition_t = std::decay_t<
+  decltype(get<N>(std::declval<argument_definitions_t<T, Traits>&>()))>;
+
+// Built once per (T, Traits), on first use; shared by parsing, usage, and
+// validation
+template <class T, class Traits>
+const argument_definitions_t<T, Traits>& get_argument_definitions() {
+  static const argument_definitions_t<T, Traits> ret
+    = make_argument_definitions<T, Traits>();
+  return ret;
+}
+
+template <class T, std::size_t N, class Traits>
+const argument_definition_t<T, N, Traits>& get_argument_definition() {
+  return get<N>(get_argument_definitions<T, Traits>());
+}
+}// namespace magic_args::detail
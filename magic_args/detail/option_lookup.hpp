@@ -0,0 +1,272 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include <magic_args/incomplete_parse_reason.hpp>
+#include "argument_descriptor.hpp"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace magic_args::detail {
+
+enum class option_match_kind {
+  NameAndValue,
+  NameOnly,
+};
+
+struct option_match {
+  std::size_t mIndex {};
+  option_match_kind mKind {};
+  // Only if `mKind` is `NameAndValue`
+  std::string_view mValue;
+};
+
+// FNV-1a
+constexpr std::uint64_t hash_option_name(std::string_view name) noexcept {
+  std::uint64_t ret = 0xcbf29ce484222325;
+  for (auto&& c: name) {
+    ret ^= static_cast<unsigned char>(c);
+    ret *= 0x100000001b3;
+  }
+  return ret;
+}
+
+// Open-addressed hash table from option name to member index.
+//
+// Names are not copied; they must outlive the table.
+//
+// The table is kept at most half-full, and the full hash is compared before
+// the name, so a lookup is almost always one hash plus one string comparison.
+class option_name_table {
+ public:
+  option_name_table() = default;
+  explicit option_name_table(std::size_t count)
+    : mSlots(std::bit_ceil(std::max<std::size_t>(count * 2, 1))) {
+  }
+
+  void insert(std::string_view name, std::size_t index) {
+    const auto hash = hash_option_name(name);
+    for (auto i = hash & mask();; i = (i + 1) & mask()) {
+      auto& slot = mSlots[i];
+      if (slot.mIndex == npos) {
+        slot = {name, hash, index};
+        return;
+      }
+      if (slot.mHash == hash && slot.mName == name) {
+        // First definition wins, matching declaration order
+        return;
+      }
+    }
+  }
+
+  [[nodiscard]]
+  std::optional<std::size_t> find(std::string_view name) const noexcept {
+    if (mSlots.empty()) {
+      return std::nullopt;
+    }
+    const auto hash = hash_option_name(name);
+    for (auto i = hash & mask();; i = (i + 1) & mask()) {
+      const auto& slot = mSlots[i];
+      if (slot.mIndex == npos) {
+        return std::nullopt;
+      }
+      if (slot.mHash == hash && slot.mName == name) {
+        return slot.mIndex;
+      }
+    }
+  }
+
+ private:
+  static constexpr auto npos = ~std::size_t {0};
+  struct slot_t {
+    std::string_view mName;
+    std::uint64_t mHash {};
+    std::size_t mIndex {npos};
+  };
+  std::vector<slot_t> mSlots;
+
+  [[nodiscard]]
+  std::size_t mask() const noexcept {
+    return mSlots.size() - 1;
+  }
+};
+
+// Sorted names, for matching unambiguous prefixes with a binary search
+class option_prefix_table {
+ public:
+  static constexpr auto npos = ~std::size_t {0};
+
+  void insert(std::string_view name, std::size_t index) {
+    mNames.emplace_back(name, index);
+  }
+
+  // Call after all `insert()`s
+  void sort() {
+    // Stable, so that the first definition wins, matching declaration order
+    std::ranges::stable_sort(mNames, {}, &entry_t::first);
+    const auto [first, last]
+      = std::ranges::unique(mNames, {}, &entry_t::first);
+    mNames.erase(first, last);
+  }
+
+  // Entries with the index `ignored` are skipped; pass `npos` to consider all
+  [[nodiscard]]
+  std::optional<std::expected<std::size_t, incomplete_parse_reason>> find(
+    std::string_view prefix,
+    std::size_t ignored) const noexcept {
+    if (prefix.empty()) {
+      return std::nullopt;
+    }
+    std::optional<std::size_t> ret;
+    for (auto it
+         = std::ranges::lower_bound(mNames, prefix, {}, &entry_t::first);
+         it != mNames.end() && it->first.starts_with(prefix);
+         ++it) {
+      if (it->second == ignored) {
+        continue;
+      }
+      if (ret) {
+        return std::unexpected {incomplete_parse_reason::AmbiguousArgument};
+      }
+      ret = it->second;
+    }
+    if (!ret) {
+      return std::nullopt;
+    }
+    return *ret;
+  }
+
+ private:
+  using entry_t = std::pair<std::string_view, std::size_t>;
+  std::vector<entry_t> mNames;
+};
+
+struct option_lookup {
+  static constexpr auto no_option = std::numeric_limits<std::uint16_t>::max();
+  // Indices in `mLongNamePrefixes` for the built-in `--help` and `--version`
+  static constexpr auto help_option = option_prefix_table::npos - 1;
+  static constexpr auto version_option = help_option - 1;
+
+  option_name_table mLongNames;
+  option_name_table mShortNames;
+  // Only populated if `parsing_style::mAllowUnambiguousPrefixes`
+  option_prefix_table mLongNamePrefixes;
+  // Member indices for single-byte short names, for bundles like `-abc`
+  std::array<std::uint16_t, 256> mShortNameBytes {};
+};
+
+inline option_lookup make_option_lookup(
+  std::span<const argument_descriptor> arguments,
+  const parsing_style& style) {
+  const auto N = arguments.size();
+  option_lookup ret {
+    option_name_table {N},
+    option_name_table {N},
+  };
+  ret.mShortNameBytes.fill(option_lookup::no_option);
+  for (std::size_t i = 0; i < N; ++i) {
+    const auto& def = arguments[i];
+    if (!def.is_option()) {
+      continue;
+    }
+    ret.mLongNames.insert(def.mName, i);
+    if (style.mAllowUnambiguousPrefixes) {
+      ret.mLongNamePrefixes.insert(def.mName, i);
+    }
+    if (!def.mShortName.empty()) {
+      ret.mShortNames.insert(def.mShortName, i);
+    }
+    if (def.mShortName.size() == 1) {
+      auto& slot = ret.mShortNameBytes.at(
+        static_cast<unsigned char>(def.mShortName.front()));
+      if (slot == option_lookup::no_option) {
+        slot = static_cast<std::uint16_t>(i);
+      }
+    }
+  }
+  if (style.mAllowUnambiguousPrefixes) {
+    // After the members, so that a member with the same name wins
+    ret.mLongNamePrefixes.insert(style.mLongHelpArg, option_lookup::help_option);
+    ret.mLongNamePrefixes.insert(
+      style.mVersionArg, option_lookup::version_option);
+  }
+  ret.mLongNamePrefixes.sort();
+  return ret;
+}
+
+using find_option_result
+  = std::optional<std::expected<option_match, incomplete_parse_reason>>;
+
+// If `style.mAllowUnambiguousPrefixes`, the match may be
+// `option_lookup::help_option` or `option_lookup::version_option`; the latter
+// is only considered if `hasVersion`.
+[[nodiscard]]
+inline find_option_result find_option(
+  const option_lookup& lookup,
+  const parsing_style& style,
+  std::string_view arg,
+  bool hasVersion) {
+  using enum option_match_kind;
+  std::optional<option_match> ret;
+
+  const auto longPrefix = style.mLongArgPrefix;
+  const auto separator = style.mValueSeparator;
+  const bool isLong = arg.starts_with(longPrefix);
+  auto longName = arg.substr(isLong ? longPrefix.size() : arg.size());
+  auto longKind = NameOnly;
+  std::string_view value;
+  // Separators are usually a single character, e.g. `=`
+  const auto it = (separator.size() == 1) ? longName.find(separator.front())
+                                          : longName.find(separator);
+  if (it != std::string_view::npos) {
+    value = longName.substr(it + separator.size());
+    longName = longName.substr(0, it);
+    longKind = NameAndValue;
+  }
+
+  if (isLong) {
+    if (const auto index = lookup.mLongNames.find(longName)) {
+      ret = {*index, longKind, value};
+    }
+  }
+
+  if (const auto shortPrefix = style.mShortArgPrefix;
+      (!shortPrefix.empty()) && arg.starts_with(shortPrefix)) {
+    const auto index = lookup.mShortNames.find(arg.substr(shortPrefix.size()));
+    // If both match, the earlier member wins
+    if (index && ((!ret) || *index < ret->mIndex)) {
+      ret = {*index, NameOnly};
+    }
+  }
+
+  if (ret) {
+    return ret;
+  }
+
+  if (style.mAllowUnambiguousPrefixes && isLong) {
+    if (const auto index = lookup.mLongNamePrefixes.find(
+          longName,
+          hasVersion ? option_prefix_table::npos
+                     : option_lookup::version_option)) {
+      if (!index->has_value()) {
+        return std::unexpected {index->error()};
+      }
+      return option_match {**index, longKind, value};
+    }
+  }
+  return std::nullopt;
+}
+
+}// namespace magic_args::detail
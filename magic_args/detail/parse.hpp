@@ -3,17 +3,26 @@
 #pragma once
 
 #ifndef MAGIC_ARGS_SINGLE_FILE
-#include <magic_args/argument_definitions.hpp>
+#include <magic_args/argument_view.hpp>
 #include <magic_args/incomplete_parse_reason.hpp>
+#include <magic_args/program_info.hpp>
 
+#include "argument_descriptor.hpp"
+#include "option_lookup.hpp"
+#include "parser_descriptor.hpp"
 #include "print.hpp"
+#include "unicode.hpp"
+#include "usage.hpp"
 #endif
 
+#include <algorithm>
+#include <cstdio>
 #include <expected>
+#include <memory>
+#include <memory_resource>
 #include <optional>
-#include <span>
-#include <sstream>
-#include <string>
+#include <string_view>
+#include <vector>
 
 #ifndef __cpp_lib_expected
 static_assert(
@@ -24,174 +33,429 @@ static_assert(
 
 namespace magic_args::detail {
 
-enum class option_match_kind {
-  NameAndValue,
-  NameOnly,
+// `arg == prefix + name`, without building a string
+constexpr bool is_prefixed_name(
+  std::string_view arg,
+  std::string_view prefix,
+  std::string_view name) noexcept {
+  return arg.size() == prefix.size() + name.size() && arg.starts_with(prefix)
+    && arg.ends_with(name);
+}
+
+// Implemented by `magic_args::response_files<>`
+template <class Traits>
+concept expands_response_files = requires(
+  std::shared_ptr<const void>& owner,
+  argument_view args,
+  FILE* errorStream) {
+  Traits::expand_response_files(owner, args, errorStream);
 };
 
-template <class Traits, basic_option T>
-[[nodiscard]]
-std::optional<option_match_kind> option_matches(
-  const T& argDef,
-  std::string_view arg) {
-  const auto name = std::format("{}{}", Traits::long_arg_prefix, argDef.mName);
-  if (arg == name) {
-    return option_match_kind::NameOnly;
-  }
-  if (arg.starts_with(name + Traits::value_separator)) {
-    return option_match_kind::NameAndValue;
-  }
-  if constexpr (requires { Traits::short_arg_prefix; }) {
-    if (
-      (!argDef.mShortName.empty())
-      && arg
-        == std::format("{}{}", Traits::short_arg_prefix, argDef.mShortName)) {
-      return option_match_kind::NameOnly;
+// Returns the index of the first argument after the program name that is not
+// valid UTF-8, if any
+inline std::optional<std::size_t> find_invalid_utf8(
+  argument_view args) noexcept {
+  for (std::size_t i = 1; i < args.size(); ++i) {
+    if (!is_valid_utf8(args[i])) {
+      return i;
     }
   }
   return std::nullopt;
 }
 
-template <class T>
-struct arg_parse_match {
-  T mValue;
-  std::size_t mConsumed;
-};
-
-template <class T>
-using arg_parse_result
-  = std::optional<std::expected<arg_parse_match<T>, incomplete_parse_reason>>;
-
-template <
-  class Traits,
-  basic_argument T,
-  class V = std::decay_t<typename T::value_type>>
-  requires(!basic_option<T>)
-arg_parse_result<V> parse_option(
-  [[maybe_unused]] const T& arg,
-  [[maybe_unused]] std::span<std::string_view> args) {
-  return std::nullopt;
-}
+// Binds the matched option, and returns the number of arguments consumed
+inline std::expected<std::size_t, incomplete_parse_reason> parse_option(
+  void* out,
+  const parser_descriptor& parser,
+  const option_match& match,
+  argument_view args,
+  std::string_view argv0,
+  FILE* errorStream) {
+  using enum incomplete_parse_reason;
+  using enum option_match_kind;
 
-template <class T>
-void from_string_arg_outer(T& out, std::string_view arg)
-  requires requires { from_string_argument(out, arg); }
-{
-  from_string_argument(out, arg);
-}
+  const auto& def = parser.mArguments[match.mIndex];
+  std::size_t consumed = 1;
+  std::string_view value;
+  if (def.mKind == argument_kind::Option) {
+    switch (match.mKind) {
+      case NameOnly: {
+        if (args.size() == 1) {
+          return std::unexpected {MissingArgumentValue};
+        }
+        value = args[1];
+        ++consumed;
+        break;
+      }
+      case NameAndValue: {
+        value = match.mValue;
+        break;
+      }
+    }
+  }
 
-template <class T>
-void from_string_arg_outer(T& out, std::string_view arg)
-  requires(!std::assignable_from<T&, std::string>)
-  && requires(std::stringstream ss, T v) { ss >> v; }
-{
-  std::stringstream ss {std::string {arg}};
-  ss >> out;
+  if (const auto bound = def.mBindOption(out, value); !bound) {
+    detail::println(
+      errorStream,
+      "{}: Invalid value for `{}{}`: `{}`",
+      program_name(argv0),
+      parser.mStyle.mLongArgPrefix,
+      def.mName,
+      value);
+    return std::unexpected {bound.error()};
+  }
+  return consumed;
 }
 
-template <class T>
-  requires std::assignable_from<T&, std::string>
-void from_string_arg_outer(T& out, std::string_view arg) {
-  out = std::string {arg};
-}
+// Handles bundles of single-character short options, e.g. `-abc`.
+//
+// All but the last option must be flags. If the last option takes a value, it
+// is either the rest of the bundle (`-ofile`), or the next argument
+// (`-o file`).
+//
+// Returns the number of arguments consumed, or `std::nullopt` if `args.front()`
+// is not a bundle of known short options.
+inline std::optional<std::expected<std::size_t, incomplete_parse_reason>>
+parse_short_option_bundle(
+  void* out,
+  const parser_descriptor& parser,
+  argument_view args,
+  std::string_view argv0,
+  FILE* errorStream) {
+  const auto longPrefix = parser.mStyle.mLongArgPrefix;
+  const auto shortPrefix = parser.mStyle.mShortArgPrefix;
+  const auto& lookup = parser.mOptions;
+  const auto takesValue = [&parser](const std::size_t index) {
+    return parser.mArguments[index].mKind == argument_kind::Option;
+  };
 
-template <class T>
-  requires requires(T v, std::string_view arg) {
-    from_string_arg_outer(v, arg);
+  const auto arg = args.front();
+  if (
+    shortPrefix.empty() || arg.size() <= shortPrefix.size()
+    || !arg.starts_with(shortPrefix)) {
+    return std::nullopt;
   }
-void from_string_arg_outer(std::optional<T>& out, std::string_view arg) {
-  T value {};
-  from_string_arg_outer(value, arg);
-  out = std::move(value);
-}
-
-template <
-  class Traits,
-  basic_option T,
-  class V = std::decay_t<typename T::value_type>>
-arg_parse_result<V> parse_option(
-  const T& argDef,
-  std::span<std::string_view> args) {
-  using enum incomplete_parse_reason;
-  using enum option_match_kind;
-  const auto match = option_matches<Traits>(argDef, args.front());
-  if (!match) {
+  if (
+    longPrefix.size() > shortPrefix.size() && arg.starts_with(longPrefix)) {
     return std::nullopt;
   }
+  const auto bundle = arg.substr(shortPrefix.size());
 
-  std::size_t consumed = 1;
-  std::string_view value;
-  switch (match.value()) {
-    case NameOnly: {
-      if (args.size() == 1) {
-        return std::unexpected {MissingArgumentValue};
-      }
-      value = args[1];
-      ++consumed;
-      break;
+  // Check everything is valid before modifying `out`
+  for (auto&& c: bundle) {
+    const auto index = lookup.mShortNameBytes[static_cast<unsigned char>(c)];
+    if (index == option_lookup::no_option) {
+      return std::nullopt;
     }
-    case NameAndValue: {
-      const auto it = args.front().find(Traits::value_separator);
-      value = args.front().substr(it + std::size(Traits::value_separator) - 1);
+    if (takesValue(index)) {
       break;
     }
   }
 
-  V ret {};
-  from_string_arg_outer(ret, value);
-  return {arg_parse_match {ret, consumed}};
+  std::size_t consumed = 1;
+  for (std::size_t i = 0; i < bundle.size(); ++i) {
+    const auto index
+      = lookup.mShortNameBytes[static_cast<unsigned char>(bundle[i])];
+    option_match match {index, option_match_kind::NameOnly};
+    if (takesValue(index) && i + 1 < bundle.size()) {
+      match = {index, option_match_kind::NameAndValue, bundle.substr(i + 1)};
+    }
+    const auto result
+      = parse_option(out, parser, match, args, argv0, errorStream);
+    if (!result) {
+      return std::unexpected {result.error()};
+    }
+    consumed = *result;
+    if (takesValue(index)) {
+      break;
+    }
+  }
+  return consumed;
 }
 
-template <class Traits>
-arg_parse_result<bool> parse_option(
-  const flag& arg,
-  std::span<std::string_view> args) {
-  if (option_matches<Traits>(arg, args.front())) {
-    return {arg_parse_match {true, 1}};
+// Binds positional arguments, in declaration order
+inline std::optional<incomplete_parse_reason> parse_positional_arguments(
+  void* out,
+  const parser_descriptor& parser,
+  argument_view& remaining,
+  const positional_argument_storage& storage,
+  std::string_view argv0,
+  FILE* errorStream) {
+  for (auto&& def: parser.mArguments) {
+    if (def.is_option()) {
+      continue;
+    }
+    if (remaining.empty()) {
+      if (def.mKind == argument_kind::MandatoryPositional) {
+        detail::println(
+          errorStream,
+          "{}: Missing required argument `{}`",
+          program_name(argv0),
+          def.mName);
+        return incomplete_parse_reason::MissingRequiredArgument;
+      }
+      if (!def.mMultipleValues) {
+        continue;
+      }
+      // Bound with no values, as `reset_to_default()` skips containers
+    }
+
+    const auto values
+      = def.mMultipleValues ? remaining : remaining.subspan(0, 1);
+    std::string_view invalidValue;
+    if (const auto bound
+        = def.mBindPositional(out, values, storage, invalidValue);
+        !bound) {
+      detail::println(
+        errorStream,
+        "{}: Invalid value for `{}`: `{}`",
+        program_name(argv0),
+        def.mName,
+        invalidValue);
+      return bound.error();
+    }
+    remaining = remaining.subspan(values.size());
   }
   return std::nullopt;
 }
 
-template <class Traits, basic_argument T, class V = typename T::value_type>
-  requires(!basic_option<T>)
-arg_parse_result<V> parse_positional_argument(
-  const T& argDef,
-  std::string_view arg0,
-  std::span<std::string_view> args,
+// The non-template core of `parse<T, Traits>()`; `out` is a
+// default-initialized `T*`, described by `parser`.
+//
+// `argsOwner` keeps `args` alive, if they are not owned by the caller of
+// `parse()`; it is shared with any `positional_argument_range<>` in the result
+//
+// Temporary copies of positional arguments are allocated from `resource`, or
+// `std::pmr::get_default_resource()` if it is null
+//
+// `formattedUsage` is from `format_usage()`, or empty to format the usage
+// only if it is shown
+inline std::optional<incomplete_parse_reason> parse_arguments(
+  void* out,
+  const parser_descriptor& parser,
+  argument_view args,
+  std::shared_ptr<const void> argsOwner,
+  std::pmr::memory_resource* resource,
+  const program_info& help,
+  std::string_view formattedUsage,
+  FILE* outputStream,
   FILE* errorStream) {
-  using namespace detail;
-
+  // Not even a program name, e.g. `argc == 0`
   if (args.empty()) {
-    if constexpr (T::is_required) {
-      detail::println(
-        errorStream, "{}: Missing required argument `{}`", arg0, argDef.mName);
-      return std::unexpected {incomplete_parse_reason::MissingRequiredArgument};
-    } else {
-      return std::nullopt;
+    detail::println(errorStream, "No arguments, not even a program name");
+    return incomplete_parse_reason::InvalidArgument;
+  }
+
+  const auto& style = parser.mStyle;
+  const auto argv0 = args.front();
+  const auto showUsage = [&](FILE* stream) {
+    show_usage(stream, argv0, help, parser, formattedUsage);
+  };
+
+  // After expanding response files, so that their contents are checked too
+  if (style.mValidateUtf8) {
+    if (const auto invalid = find_invalid_utf8(args)) {
+      detail::print(
+        errorStream,
+        "{}: Argument {} is not valid UTF-8\n\n",
+        program_name(argv0),
+        *invalid);
+      showUsage(errorStream);
+      return incomplete_parse_reason::InvalidEncoding;
     }
   }
-  if constexpr (vector_like<V>) {
-    V ret {};
-    ret.reserve(args.size());
-    for (auto&& arg: args) {
-      typename V::value_type v {};
-      from_string_arg_outer(v, arg);
-      ret.push_back(std::move(v));
+
+  const bool hasVersion = !help.mVersion.empty();
+  // Like `getopt_long()`, accept unambiguous prefixes of `--help` and
+  // `--version` if they are accepted for other options
+  const auto builtinPrefix = [&](std::string_view arg) {
+    if (!(style.mAllowUnambiguousPrefixes
+          && arg.starts_with(style.mLongArgPrefix))) {
+      return option_prefix_table::npos;
+    }
+    const auto match = find_option(parser.mOptions, style, arg, hasVersion);
+    if (!(match && match->has_value()
+          && (*match)->mKind == option_match_kind::NameOnly)) {
+      return option_prefix_table::npos;
+    }
+    return (*match)->mIndex;
+  };
+  const auto isHelp = [&](std::string_view arg) {
+    if (is_prefixed_name(arg, style.mLongArgPrefix, style.mLongHelpArg)) {
+      return true;
+    }
+    return (!style.mShortHelpArg.empty())
+      && is_prefixed_name(arg, style.mShortArgPrefix, style.mShortHelpArg);
+  };
+
+  for (auto&& arg: args) {
+    if (arg == "--") {
+      break;
+    }
+    const auto builtin = builtinPrefix(arg);
+    if (isHelp(arg) || builtin == option_lookup::help_option) {
+      showUsage(outputStream);
+      return incomplete_parse_reason::HelpRequested;
+    }
+    if (
+      hasVersion
+      && (is_prefixed_name(arg, style.mLongArgPrefix, style.mVersionArg)
+          || builtin == option_lookup::version_option)) {
+      detail::println(outputStream, "{}", help.mVersion);
+      return incomplete_parse_reason::VersionRequested;
     }
-    return {arg_parse_match {ret, args.size()}};
-  } else {
-    V ret {};
-    from_string_arg_outer(ret, args.front());
-    return arg_parse_match {std::move(ret), 1};
   }
-}
 
-template <class Traits, basic_option T, class V = typename T::value_type>
-arg_parse_result<V> parse_positional_argument(
-  [[maybe_unused]] const T& argDef,
-  [[maybe_unused]] std::string_view arg0,
-  [[maybe_unused]] std::span<std::string_view> args,
-  [[maybe_unused]] FILE* errorStream) {
+  // Positional arguments are only copied into `positionalArgs` if they are
+  // not contiguous in `args`, e.g. if they are mixed with options.
+  //
+  // The copy is sized for every remaining argument, and truncated to
+  // `positionalCount` afterwards; this avoids reallocating, and the per-element
+  // overhead of `push_back()` with a stateful allocator.
+  std::size_t contiguousBegin {0};
+  std::size_t contiguousEnd {0};
+  std::pmr::vector<std::string_view> positionalArgs {
+    resource ? resource : std::pmr::get_default_resource()};
+  std::size_t positionalCount {0};
+  const auto addPositionalArg = [&](const std::size_t i) {
+    if (positionalArgs.empty()) {
+      if (contiguousBegin == contiguousEnd) {
+        contiguousBegin = i;
+        contiguousEnd = i + 1;
+        return;
+      }
+      if (contiguousEnd == i) {
+        ++contiguousEnd;
+        return;
+      }
+      const auto contiguous
+        = args.subspan(contiguousBegin, contiguousEnd - contiguousBegin);
+      positionalArgs.resize(args.size() - contiguousBegin);
+      std::ranges::copy(contiguous, positionalArgs.begin());
+      positionalCount = contiguous.size();
+    }
+    positionalArgs[positionalCount++] = args[i];
+  };
+  // Everything after `--`
+  argument_view afterSeparator;
+
+  // Handle options
+  const auto shortPrefix = style.mShortArgPrefix;
+  for (std::size_t i = 1; i < args.size();) {
+    const auto arg = args[i];
+    if (arg == "--") {
+      afterSeparator = args.subspan(i + 1);
+      break;
+    }
+
+    // Fast path for positional arguments, which are often the majority
+    if (!(arg.starts_with(style.mLongArgPrefix)
+          || ((!shortPrefix.empty()) && arg.starts_with(shortPrefix)))) {
+      addPositionalArg(i);
+      ++i;
+      continue;
+    }
+
+    if (const auto match
+        = find_option(parser.mOptions, style, arg, hasVersion);
+        match
+        // e.g. `--he=value`; unlike `--he`, not handled above
+        && !(match->has_value()
+             && (*match)->mIndex >= parser.mArguments.size())) {
+      if (!match->has_value()) {
+        detail::print(
+          errorStream,
+          "{}: Ambiguous option: {}\n\n",
+          program_name(argv0),
+          arg);
+        showUsage(errorStream);
+        return match->error();
+      }
+      const auto consumed = parse_option(
+        out, parser, **match, args.subspan(i), argv0, errorStream);
+      if (!consumed) {
+        detail::println(errorStream, "");
+        showUsage(errorStream);
+        return consumed.error();
+      }
+      i += *consumed;
+      continue;
+    }
+
+    if (const auto bundle = parse_short_option_bundle(
+          out, parser, args.subspan(i), argv0, errorStream)) {
+      if (!bundle->has_value()) {
+        detail::println(errorStream, "");
+        showUsage(errorStream);
+        return bundle->error();
+      }
+      i += **bundle;
+      continue;
+    }
+
+    // The short prefixes have other meanings, e.g.:
+    //
+    // GNU, Powershell: `-` often means 'stdout'
+    // Classic MS: '/' can mean 'root of the filesystem
+    if (
+      arg.starts_with(style.mLongArgPrefix)
+      || ((!shortPrefix.empty()) && arg.starts_with(shortPrefix)
+          && arg != shortPrefix)) {
+      detail::print(
+        errorStream,
+        "{}: Unrecognized option: {}\n\n",
+        program_name(argv0),
+        arg);
+      showUsage(errorStream);
+      return incomplete_parse_reason::InvalidArgument;
+    }
+
+    addPositionalArg(i);
+    ++i;
+  }
+
+  // Handle positional args; `remaining` is advanced as they are bound, so
+  // the total cost is linear in the number of arguments
+  argument_view remaining;
+  if (!positionalArgs.empty()) {
+    positionalArgs.resize(positionalCount);
+    remaining = positionalArgs;
+  } else if (contiguousBegin != contiguousEnd) {
+    remaining = args.subspan(contiguousBegin, contiguousEnd - contiguousBegin);
+  }
+  if (remaining.empty()) {
+    remaining = afterSeparator;
+  } else if (!afterSeparator.empty()) {
+    if (positionalArgs.empty()) {
+      positionalArgs.reserve(remaining.size() + afterSeparator.size());
+      positionalArgs.assign(remaining.begin(), remaining.end());
+    }
+    positionalArgs.insert(
+      positionalArgs.end(), afterSeparator.begin(), afterSeparator.end());
+    remaining = positionalArgs;
+  }
+  const positional_argument_storage storage {
+    .mInArgs = positionalArgs.empty(),
+    .mOwner = std::move(argsOwner),
+    .mResource = resource,
+  };
+  if (const auto failure = parse_positional_arguments(
+        out, parser, remaining, storage, argv0, errorStream)) {
+    detail::println(errorStream, "");
+    showUsage(errorStream);
+    return failure;
+  }
+
+  if (!remaining.empty()) {
+    detail::print(
+      errorStream,
+      "{}: Invalid positional argument: {}\n\n",
+      program_name(argv0),
+      remaining.front());
+    showUsage(errorStream);
+    return incomplete_parse_reason::InvalidArgument;
+  }
+
   return std::nullopt;
 }
 
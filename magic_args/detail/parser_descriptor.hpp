@@ -0,0 +1,326 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include <magic_args/argument_definitions.hpp>
+#include <magic_args/argument_view.hpp>
+#include <magic_args/positional_argument_range.hpp>
+
+#include "argument_descriptor.hpp"
+#include "concepts.hpp"
+#include "conversions.hpp"
+#include "get_argument_definition.hpp"
+#include "option_lookup.hpp"
+#include "reflection.hpp"
+#endif
+
+#include <algorithm>
+#include <concepts>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace magic_args::detail {
+
+// Everything that `parse()` and `show_usage()` need to know about a
+// (T, Traits), so that they do not need to be templates
+struct parser_descriptor {
+  parsing_style mStyle;
+  // In declaration order; option and member indices are the same
+  std::vector<argument_descriptor> mArguments;
+  option_lookup mOptions;
+};
+
+// `copy` is an empty `std::vector<std::string_view>` or
+// `std::pmr::vector<std::string_view>`
+template <argument_range V, class Vector>
+V make_owned_argument_range(
+  argument_view args,
+  std::shared_ptr<const void> argsOwner,
+  Vector copy) {
+  struct owned_t {
+    Vector mArgs;
+    std::shared_ptr<const void> mOwner;
+  };
+  copy.reserve(args.size());
+  copy.insert(copy.end(), args.begin(), args.end());
+  const auto allocator = copy.get_allocator();
+  auto owned = std::allocate_shared<const owned_t>(
+    allocator, std::move(copy), std::move(argsOwner));
+  return V {owned->mArgs, owned};
+}
+
+template <argument_range V>
+V make_argument_range(
+  argument_view args,
+  const positional_argument_storage& storage) {
+  if (storage.mInArgs) {
+    return V {args, storage.mOwner};
+  }
+  if (storage.mResource) {
+    return make_owned_argument_range<V>(
+      args,
+      storage.mOwner,
+      std::pmr::vector<std::string_view> {storage.mResource});
+  }
+  return make_owned_argument_range<V>(
+    args, storage.mOwner, std::vector<std::string_view> {});
+}
+
+// The value of a member; this is `mValue` for `option<>` and other argument
+// definitions, or the member itself
+template <class T>
+auto& argument_value(T& member) {
+  if constexpr (basic_argument<T>) {
+    return member.mValue;
+  } else {
+    return member;
+  }
+}
+
+// True if `V` is a `std::string_view`, or an `std::optional` or container of
+// them
+template <class V>
+consteval bool is_argument_view() {
+  if constexpr (std::same_as<V, std::string_view>) {
+    return true;
+  } else if constexpr (
+    std_optional<V> || (vector_like<V> && !argument_range<V>)) {
+    return is_argument_view<typename V::value_type>();
+  } else {
+    return false;
+  }
+}
+
+// True if `T` has members that refer to the arguments passed to `parse()`
+// without keeping them alive; unlike `positional_argument_range<>`, these
+// would dangle if `parse()` copies the arguments, e.g. to convert them to
+// UTF-8.
+template <class T>
+consteval bool has_argument_views() {
+  return []<std::size_t... I>(std::index_sequence<I...>) {
+    return (
+      is_argument_view<std::remove_cvref_t<decltype(argument_value(
+        std::declval<member_value_t<T, I>&>()))>>()
+      || ...);
+  }(std::make_index_sequence<count_members<T>()> {});
+}
+
+// A default-initialized `T`, built once; `parse_into()` copy-assigns from
+// this, which keeps the capacity of strings and containers in `out`
+template <class T>
+const T& default_value() {
+  static const T ret {};
+  return ret;
+}
+
+// Copy-assigns the value of every member of `out` from `default_value<T>()`.
+//
+// Multi-value positional arguments such as `std::vector<std::string>` are
+// skipped: copying an empty vector would destroy its elements. Instead, they
+// are always bound, and either overwrite the existing elements, or restore
+// the default values if no arguments are given.
+template <class T>
+void reset_to_default(T& out) {
+  const auto reset = []<class V>(V& value, const V& defaultValue) {
+    if constexpr (!(vector_like<V> && !argument_range<V>)) {
+      value = defaultValue;
+    }
+  };
+  auto members = tie_struct(out);
+  const auto defaults = tie_struct(default_value<T>());
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    (reset(argument_value(get<I>(members)), argument_value(get<I>(defaults))),
+     ...);
+  }(std::make_index_sequence<count_members<T>()> {});
+}
+
+// Strings are converted in place, so that `parse_into()` reuses their
+// capacity. Other values are converted into a temporary, so that
+// `from_string_argument()` always starts from a default-initialized value.
+template <class V>
+from_string_result convert_argument(V& value, std::string_view arg) {
+  if constexpr (requires { value.assign(arg.data(), arg.size()); }) {
+    return from_string_arg_outer(value, arg);
+  } else {
+    V converted {};
+    if (const auto result = from_string_arg_outer(converted, arg); !result) {
+      return result;
+    }
+    value = std::move(converted);
+    return {};
+  }
+}
+
+// Re-creates the allocator-aware values in `out` with `resource`, e.g.
+// `std::pmr::string` and `std::pmr::vector<std::pmr::string>`, keeping their
+// default values
+template <class T>
+void use_memory_resource(T& out, std::pmr::memory_resource* resource) {
+  using allocator_t = std::pmr::polymorphic_allocator<>;
+  const allocator_t allocator {resource};
+  const auto rebind = [&allocator]<class V>(V& value) {
+    if constexpr (std::uses_allocator_v<V, allocator_t>) {
+      auto replacement
+        = std::make_obj_using_allocator<V>(allocator, std::as_const(value));
+      std::destroy_at(&value);
+      std::construct_at(&value, std::move(replacement));
+    }
+  };
+  auto members = tie_struct(out);
+  [&]<std::size_t... I>(std::index_sequence<I...>) {
+    (rebind(argument_value(get<I>(members))), ...);
+  }(std::make_index_sequence<count_members<T>()> {});
+}
+
+// An `option_binder_t` for member `I` of `T`
+template <class T, std::size_t I, class Traits>
+from_string_result bind_option(void* out, std::string_view value) {
+  using TDef = argument_definition_t<T, I, Traits>;
+  auto& member = get<I>(tie_struct(*static_cast<T*>(out)));
+  if constexpr (std::same_as<TDef, counted_flag>) {
+    ++member.mValue;
+  } else if constexpr (std::same_as<TDef, flag>) {
+    member = true;
+  } else {
+    return convert_argument(argument_value(member), value);
+  }
+  return {};
+}
+
+// A `positional_binder_t` for member `I` of `T`
+template <class T, std::size_t I, class Traits>
+from_string_result bind_positional_argument(
+  void* out,
+  argument_view values,
+  const positional_argument_storage& storage,
+  std::string_view& invalidValue) {
+  using V = typename argument_definition_t<T, I, Traits>::value_type;
+  auto& member = get<I>(tie_struct(*static_cast<T*>(out)));
+
+  const auto convert = [&invalidValue](auto& value, std::string_view arg) {
+    const auto converted = convert_argument(value, arg);
+    if (!converted) {
+      invalidValue = arg;
+    }
+    return converted;
+  };
+
+  if (values.empty()) {
+    // An optional multi-value positional argument that was not given
+    if constexpr (vector_like<V> && !argument_range<V>) {
+      auto& ret = argument_value(member);
+      const auto& defaultValue
+        = argument_value(get<I>(tie_struct(default_value<T>())));
+      if (defaultValue.empty()) {
+        ret.clear();
+      } else {
+        ret = defaultValue;
+      }
+    }
+    return {};
+  }
+
+  if constexpr (argument_range<V>) {
+    // Infallible conversions are left until the values are used
+    if constexpr (fallible_conversion<typename V::value_type>) {
+      for (auto&& arg: values) {
+        typename V::value_type v {};
+        if (const auto converted = convert(v, arg); !converted) {
+          return converted;
+        }
+      }
+    }
+    member = make_argument_range<V>(values, storage);
+  } else if constexpr (vector_like<V>) {
+    // Replaces any default values; existing elements are assigned to, so
+    // that `parse_into()` reuses their storage
+    auto& ret = argument_value(member);
+    const auto reused = std::min(ret.size(), values.size());
+    for (std::size_t i = 0; i < reused; ++i) {
+      if (const auto converted = convert(ret[i], values[i]); !converted) {
+        return converted;
+      }
+    }
+    if (ret.size() > values.size()) {
+      ret.erase(ret.begin() + values.size(), ret.end());
+      return {};
+    }
+    ret.reserve(values.size());
+    for (auto&& arg: values.subspan(reused)) {
+      // Constructed in place, so that allocator-aware elements use the
+      // container's allocator
+      if constexpr (requires { ret.emplace_back(); }) {
+        if (const auto converted = convert(ret.emplace_back(), arg);
+            !converted) {
+          return converted;
+        }
+      } else {
+        typename V::value_type v {};
+        if (const auto converted = convert(v, arg); !converted) {
+          return converted;
+        }
+        ret.push_back(std::move(v));
+      }
+    }
+  } else {
+    return convert(argument_value(member), values.front());
+  }
+  return {};
+}
+
+template <class T, std::size_t I, class Traits>
+argument_descriptor make_argument_descriptor() {
+  using TDef = argument_definition_t<T, I, Traits>;
+  const auto& def = get_argument_definition<T, I, Traits>();
+  argument_descriptor ret {
+    .mName = def.mName,
+    .mHelp = def.mHelp,
+  };
+  if constexpr (basic_option<TDef>) {
+    ret.mShortName = def.mShortName;
+    if constexpr (std::same_as<TDef, counted_flag>) {
+      ret.mKind = argument_kind::CountedFlag;
+    } else if constexpr (std::same_as<TDef, flag>) {
+      ret.mKind = argument_kind::Flag;
+    } else {
+      ret.mKind = argument_kind::Option;
+    }
+    ret.mBindOption = &bind_option<T, I, Traits>;
+  } else {
+    ret.mKind = TDef::is_required ? argument_kind::MandatoryPositional
+                                  : argument_kind::OptionalPositional;
+    ret.mMultipleValues = multiple_values<typename TDef::value_type>;
+    ret.mBindPositional = &bind_positional_argument<T, I, Traits>;
+  }
+  return ret;
+}
+
+template <class T, class Traits>
+parser_descriptor make_parser_descriptor() {
+  constexpr auto N = count_members<T>();
+  static_assert(N < option_lookup::no_option);
+  parser_descriptor ret {
+    .mStyle = make_parsing_style<Traits>(),
+    .mArguments = []<std::size_t... I>(std::index_sequence<I...>) {
+      return std::vector<argument_descriptor> {
+        make_argument_descriptor<T, I, Traits>()...};
+    }(std::make_index_sequence<N> {}),
+  };
+  ret.mOptions = make_option_lookup(ret.mArguments, ret.mStyle);
+  return ret;
+}
+
+// Built once per (T, Traits), on first use
+template <class T, class Traits>
+const parser_descriptor& get_parser_descriptor() {
+  static const parser_descriptor ret = make_parser_descriptor<T, Traits>();
+  return ret;
+}
+
+}// namespace magic_args::detail
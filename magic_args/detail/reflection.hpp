@@ -2,13 +2,58 @@
 // SPDX-License-Identifier: MIT
 #pragma once
 
+// Define `MAGIC_ARGS_ENABLE_STATIC_REFLECTION` to use C++26 static reflection
+// instead of the `std::source_location`-based implementation.
+//
+// This is opt-in until it is tested in CI with a compiler that implements it.
+#ifdef MAGIC_ARGS_ENABLE_STATIC_REFLECTION
+#if defined(__cpp_impl_reflection) && __has_include(<meta>)
+#define MAGIC_ARGS_STATIC_REFLECTION
+#include <meta>
+#else
+static_assert(
+  false,
+  "MAGIC_ARGS_ENABLE_STATIC_REFLECTION is defined, but your compiler does not "
+  "support C++26 static reflection");
+#endif
+#endif
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include "flat_tuple.hpp"
+#ifndef MAGIC_ARGS_STATIC_REFLECTION
+#include "tie_struct.hpp"
+#endif
+#endif
+
 #include <source_location>
 #include <string>
-#include <tuple>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace magic_args::detail {
 
+#ifdef MAGIC_ARGS_STATIC_REFLECTION
+// C++26 static reflection (P2996): there is no limit on the number of
+// members, and names come directly from the compiler
+template <class T>
+constexpr auto reflected_members
+  = std::define_static_array(std::meta::nonstatic_data_members_of(
+    ^^T, std::meta::access_context::unchecked()));
+
+template <class T>
+consteval std::size_t count_members() {
+  return reflected_members<T>.size();
+}
+
+template <class T>
+constexpr decltype(auto) tie_struct(T&& v) {
+  using TStruct = std::decay_t<T>;
+  return [&v]<std::size_t... I>(std::index_sequence<I...>) {
+    return flat_tie(v.[:reflected_members<TStruct>[I]:]...);
+  }(std::make_index_sequence<count_members<TStruct>()> {});
+}
+#else
 struct any_t {
   template <class T>
   constexpr operator T() const {
@@ -16,81 +61,73 @@ struct any_t {
   };
 };
 
-template <class T, class... Args>
-consteval std::size_t count_members(Args&&... args) {
-  if constexpr (requires { T {any_t {}, args...}; }) {
-    return count_members<T>(any_t {}, args...);
+template <class T, std::size_t... I>
+consteval bool is_initializable_with(std::index_sequence<I...>) {
+  return requires { T {(static_cast<void>(I), any_t {})...}; };
+}
+
+template <class T, std::size_t N>
+constexpr bool is_initializable_with_n
+  = is_initializable_with<T>(std::make_index_sequence<N> {});
+
+// Binary search, so that we only instantiate O(log N) initializations instead
+// of O(N) with an O(N) argument pack each.
+//
+// `T` can be initialized with `Min` values, but not with `Max` values
+template <class T, std::size_t Min, std::size_t Max>
+consteval std::size_t count_members_between() {
+  if constexpr (Max - Min <= 1) {
+    return Min;
   } else {
-    return sizeof...(args);
+    constexpr auto mid = Min + ((Max - Min) / 2);
+    if constexpr (is_initializable_with_n<T, mid>) {
+      return count_members_between<T, mid, Max>();
+    } else {
+      return count_members_between<T, Min, mid>();
+    }
   }
 }
 
+template <class T>
+consteval std::size_t count_members() {
+  constexpr auto limit = max_tie_struct_members + 1;
+  static_assert(
+    !is_initializable_with_n<T, limit>,
+    "Too many members; increase MAX_MEMBERS in generate_tie_struct.cmake");
+  return count_members_between<T, 0, limit>();
+}
+
 template <class T>
 constexpr decltype(auto) tie_struct(T&& v) {
-  constexpr auto count = count_members<std::decay_t<T>>();
-  // Can get rid of this mess with C++26 P1061R10 - 'Structured bindings can
-  // introduce a pack'
-  if constexpr (count > 16) {
-    static_assert(count <= 16, "Only 16 values are currently supported");
-  } else if constexpr (count == 16) {
-    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16]
-      = v;
-    return std::tie(
-      v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16);
-  } else if constexpr (count == 15) {
-    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15]
-      = v;
-    return std::tie(
-      v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15);
-  } else if constexpr (count == 14) {
-    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14] = v;
-    return std::tie(
-      v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14);
-  } else if constexpr (count == 13) {
-    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13] = v;
-    return std::tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13);
-  } else if constexpr (count == 12) {
-    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12] = v;
-    return std::tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12);
-  } else if constexpr (count == 11) {
-    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11] = v;
-    return std::tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11);
-  } else if constexpr (count == 10) {
-    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10] = v;
-    return std::tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10);
-  } else if constexpr (count == 9) {
-    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9] = v;
-    return std::tie(v1, v2, v3, v4, v5, v6, v7, v8, v9);
-  } else if constexpr (count == 8) {
-    auto& [v1, v2, v3, v4, v5, v6, v7, v8] = v;
-    return std::tie(v1, v2, v3, v4, v5, v6, v7, v8);
-  } else if constexpr (count == 7) {
-    auto& [v1, v2, v3, v4, v5, v6, v7] = v;
-    return std::tie(v1, v2, v3, v4, v5, v6, v7);
-  } else if constexpr (count == 6) {
-    auto& [v1, v2, v3, v4, v5, v6] = v;
-    return std::tie(v1, v2, v3, v4, v5, v6);
-  } else if constexpr (count == 5) {
-    auto& [v1, v2, v3, v4, v5] = v;
-    return std::tie(v1, v2, v3, v4, v5);
-  } else if constexpr (count == 4) {
-    auto& [v1, v2, v3, v4] = v;
-    return std::tie(v1, v2, v3, v4);
-  } else if constexpr (count == 3) {
-    auto& [v1, v2, v3] = v;
-    return std::tie(v1, v2, v3);
-  } else if constexpr (count == 2) {
-    auto& [v1, v2] = v;
-    return std::tie(v1, v2);
-  } else if constexpr (count == 1) {
-    auto& [v1] = v;
-    return std::tie(v1);
-  } else {
-    static_assert(count == 0);
-    return std::tuple {};
+  return tie_struct_t<count_members<std::decay_t<T>>()>::tie(v);
+}
+#endif
+
+// A compile-time string stored inline, so that only the characters we need end
+// up in the binary
+template <std::size_t N>
+struct fixed_string {
+  char mData[N + 1] {};
+
+  constexpr std::string_view view() const noexcept {
+    return {mData, N};
+  }
+};
+
+template <std::size_t N>
+constexpr fixed_string<N> make_fixed_string(std::string_view value) {
+  fixed_string<N> ret {};
+  for (std::size_t i = 0; i < N; ++i) {
+    ret.mData[i] = value[i];
   }
+  return ret;
 }
 
+#ifdef MAGIC_ARGS_STATIC_REFLECTION
+template <class T, std::size_t N>
+constexpr std::string_view member_name
+  = std::meta::identifier_of(reflected_members<T>[N]);
+#else
 template <class T>
 consteval auto mangled_name() {
   return std::source_location::current().function_name();
@@ -186,11 +223,19 @@ struct apple_workaround_t {
 };
 
 template <class T, std::size_t N>
-constexpr auto member_name = demangled_name<apple_workaround_t {
-  &std::get<N>(tie_struct(external<T>))}>();
+constexpr auto member_name_storage = [] {
+  constexpr std::string_view name = demangled_name<apple_workaround_t {
+    &get<N>(tie_struct(external<T>))}>();
+  return make_fixed_string<name.size()>(name);
+}();
 
 #ifdef __clang__
 #pragma clang diagnostic pop
 #endif
 
+// A view of a copy of just the name, rather than into the full signature
+template <class T, std::size_t N>
+constexpr std::string_view member_name = member_name_storage<T, N>.view();
+#endif
+
 }// namespace magic_args::detail
@@ -0,0 +1,2219 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+// Generated by generate_tie_struct.cmake - DO NOT EDIT
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include "flat_tuple.hpp"
+#endif
+
+#include <cstddef>
+
+namespace magic_args::detail {
+
+// clang-format off
+constexpr std::size_t max_tie_struct_members = 128;
+
+// `tie_struct_t<N>::tie(v)` returns a `flat_tuple` of references to the `N`
+// members of `v`
+template <std::size_t N>
+struct tie_struct_t;
+
+template <>
+struct tie_struct_t<0> {
+  template <class T>
+  static constexpr auto tie(T&) {
+    return flat_tuple<> {};
+  }
+};
+
+template <>
+struct tie_struct_t<1> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1] = v;
+    return flat_tie(v1);
+  }
+};
+
+template <>
+struct tie_struct_t<2> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2] = v;
+    return flat_tie(v1, v2);
+  }
+};
+
+template <>
+struct tie_struct_t<3> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3] = v;
+    return flat_tie(v1, v2, v3);
+  }
+};
+
+template <>
+struct tie_struct_t<4> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4] = v;
+    return flat_tie(v1, v2, v3, v4);
+  }
+};
+
+template <>
+struct tie_struct_t<5> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5] = v;
+    return flat_tie(v1, v2, v3, v4, v5);
+  }
+};
+
+template <>
+struct tie_struct_t<6> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6);
+  }
+};
+
+template <>
+struct tie_struct_t<7> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7);
+  }
+};
+
+template <>
+struct tie_struct_t<8> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8);
+  }
+};
+
+template <>
+struct tie_struct_t<9> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9);
+  }
+};
+
+template <>
+struct tie_struct_t<10> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10);
+  }
+};
+
+template <>
+struct tie_struct_t<11> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11);
+  }
+};
+
+template <>
+struct tie_struct_t<12> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12);
+  }
+};
+
+template <>
+struct tie_struct_t<13> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13);
+  }
+};
+
+template <>
+struct tie_struct_t<14> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13,
+      v14);
+  }
+};
+
+template <>
+struct tie_struct_t<15> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+           v15] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15);
+  }
+};
+
+template <>
+struct tie_struct_t<16> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16);
+  }
+};
+
+template <>
+struct tie_struct_t<17> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17);
+  }
+};
+
+template <>
+struct tie_struct_t<18> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18);
+  }
+};
+
+template <>
+struct tie_struct_t<19> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19);
+  }
+};
+
+template <>
+struct tie_struct_t<20> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20);
+  }
+};
+
+template <>
+struct tie_struct_t<21> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21);
+  }
+};
+
+template <>
+struct tie_struct_t<22> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22);
+  }
+};
+
+template <>
+struct tie_struct_t<23> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23);
+  }
+};
+
+template <>
+struct tie_struct_t<24> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24);
+  }
+};
+
+template <>
+struct tie_struct_t<25> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25);
+  }
+};
+
+template <>
+struct tie_struct_t<26> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26);
+  }
+};
+
+template <>
+struct tie_struct_t<27> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27);
+  }
+};
+
+template <>
+struct tie_struct_t<28> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28);
+  }
+};
+
+template <>
+struct tie_struct_t<29> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28,
+           v29] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28,
+      v29);
+  }
+};
+
+template <>
+struct tie_struct_t<30> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30);
+  }
+};
+
+template <>
+struct tie_struct_t<31> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31);
+  }
+};
+
+template <>
+struct tie_struct_t<32> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32);
+  }
+};
+
+template <>
+struct tie_struct_t<33> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33);
+  }
+};
+
+template <>
+struct tie_struct_t<34> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34);
+  }
+};
+
+template <>
+struct tie_struct_t<35> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35);
+  }
+};
+
+template <>
+struct tie_struct_t<36> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36);
+  }
+};
+
+template <>
+struct tie_struct_t<37> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37);
+  }
+};
+
+template <>
+struct tie_struct_t<38> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38);
+  }
+};
+
+template <>
+struct tie_struct_t<39> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39);
+  }
+};
+
+template <>
+struct tie_struct_t<40> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40);
+  }
+};
+
+template <>
+struct tie_struct_t<41> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41);
+  }
+};
+
+template <>
+struct tie_struct_t<42> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42);
+  }
+};
+
+template <>
+struct tie_struct_t<43> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42,
+           v43] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43);
+  }
+};
+
+template <>
+struct tie_struct_t<44> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+      v44);
+  }
+};
+
+template <>
+struct tie_struct_t<45> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45);
+  }
+};
+
+template <>
+struct tie_struct_t<46> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46);
+  }
+};
+
+template <>
+struct tie_struct_t<47> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47);
+  }
+};
+
+template <>
+struct tie_struct_t<48> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48);
+  }
+};
+
+template <>
+struct tie_struct_t<49> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49);
+  }
+};
+
+template <>
+struct tie_struct_t<50> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50);
+  }
+};
+
+template <>
+struct tie_struct_t<51> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51);
+  }
+};
+
+template <>
+struct tie_struct_t<52> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52);
+  }
+};
+
+template <>
+struct tie_struct_t<53> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53);
+  }
+};
+
+template <>
+struct tie_struct_t<54> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54);
+  }
+};
+
+template <>
+struct tie_struct_t<55> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55);
+  }
+};
+
+template <>
+struct tie_struct_t<56> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56);
+  }
+};
+
+template <>
+struct tie_struct_t<57> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56,
+           v57] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57);
+  }
+};
+
+template <>
+struct tie_struct_t<58> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58);
+  }
+};
+
+template <>
+struct tie_struct_t<59> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58,
+      v59);
+  }
+};
+
+template <>
+struct tie_struct_t<60> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60);
+  }
+};
+
+template <>
+struct tie_struct_t<61> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61);
+  }
+};
+
+template <>
+struct tie_struct_t<62> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62);
+  }
+};
+
+template <>
+struct tie_struct_t<63> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63);
+  }
+};
+
+template <>
+struct tie_struct_t<64> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64);
+  }
+};
+
+template <>
+struct tie_struct_t<65> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65);
+  }
+};
+
+template <>
+struct tie_struct_t<66> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66);
+  }
+};
+
+template <>
+struct tie_struct_t<67> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67);
+  }
+};
+
+template <>
+struct tie_struct_t<68> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68);
+  }
+};
+
+template <>
+struct tie_struct_t<69> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69);
+  }
+};
+
+template <>
+struct tie_struct_t<70> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70);
+  }
+};
+
+template <>
+struct tie_struct_t<71> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70,
+           v71] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71);
+  }
+};
+
+template <>
+struct tie_struct_t<72> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72);
+  }
+};
+
+template <>
+struct tie_struct_t<73> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73);
+  }
+};
+
+template <>
+struct tie_struct_t<74> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73,
+      v74);
+  }
+};
+
+template <>
+struct tie_struct_t<75> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75);
+  }
+};
+
+template <>
+struct tie_struct_t<76> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76);
+  }
+};
+
+template <>
+struct tie_struct_t<77> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77);
+  }
+};
+
+template <>
+struct tie_struct_t<78> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78);
+  }
+};
+
+template <>
+struct tie_struct_t<79> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79);
+  }
+};
+
+template <>
+struct tie_struct_t<80> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80);
+  }
+};
+
+template <>
+struct tie_struct_t<81> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81);
+  }
+};
+
+template <>
+struct tie_struct_t<82> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82);
+  }
+};
+
+template <>
+struct tie_struct_t<83> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83);
+  }
+};
+
+template <>
+struct tie_struct_t<84> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84);
+  }
+};
+
+template <>
+struct tie_struct_t<85> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84,
+           v85] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85);
+  }
+};
+
+template <>
+struct tie_struct_t<86> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86);
+  }
+};
+
+template <>
+struct tie_struct_t<87> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87);
+  }
+};
+
+template <>
+struct tie_struct_t<88> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88);
+  }
+};
+
+template <>
+struct tie_struct_t<89> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88,
+      v89);
+  }
+};
+
+template <>
+struct tie_struct_t<90> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90);
+  }
+};
+
+template <>
+struct tie_struct_t<91> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91);
+  }
+};
+
+template <>
+struct tie_struct_t<92> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92);
+  }
+};
+
+template <>
+struct tie_struct_t<93> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93);
+  }
+};
+
+template <>
+struct tie_struct_t<94> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94);
+  }
+};
+
+template <>
+struct tie_struct_t<95> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95);
+  }
+};
+
+template <>
+struct tie_struct_t<96> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96);
+  }
+};
+
+template <>
+struct tie_struct_t<97> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97);
+  }
+};
+
+template <>
+struct tie_struct_t<98> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98);
+  }
+};
+
+template <>
+struct tie_struct_t<99> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98,
+           v99] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99);
+  }
+};
+
+template <>
+struct tie_struct_t<100> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100);
+  }
+};
+
+template <>
+struct tie_struct_t<101> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101);
+  }
+};
+
+template <>
+struct tie_struct_t<102> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102);
+  }
+};
+
+template <>
+struct tie_struct_t<103> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103);
+  }
+};
+
+template <>
+struct tie_struct_t<104> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104);
+  }
+};
+
+template <>
+struct tie_struct_t<105> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105);
+  }
+};
+
+template <>
+struct tie_struct_t<106> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106);
+  }
+};
+
+template <>
+struct tie_struct_t<107> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107);
+  }
+};
+
+template <>
+struct tie_struct_t<108> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108);
+  }
+};
+
+template <>
+struct tie_struct_t<109> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109);
+  }
+};
+
+template <>
+struct tie_struct_t<110> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109,
+           v110] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110);
+  }
+};
+
+template <>
+struct tie_struct_t<111> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111);
+  }
+};
+
+template <>
+struct tie_struct_t<112> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112);
+  }
+};
+
+template <>
+struct tie_struct_t<113> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113);
+  }
+};
+
+template <>
+struct tie_struct_t<114> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114);
+  }
+};
+
+template <>
+struct tie_struct_t<115> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115);
+  }
+};
+
+template <>
+struct tie_struct_t<116> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116);
+  }
+};
+
+template <>
+struct tie_struct_t<117> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117);
+  }
+};
+
+template <>
+struct tie_struct_t<118> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118);
+  }
+};
+
+template <>
+struct tie_struct_t<119> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118, v119] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118, v119);
+  }
+};
+
+template <>
+struct tie_struct_t<120> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118, v119, v120] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118, v119, v120);
+  }
+};
+
+template <>
+struct tie_struct_t<121> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118, v119, v120,
+           v121] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118, v119, v120, v121);
+  }
+};
+
+template <>
+struct tie_struct_t<122> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118, v119, v120, v121,
+           v122] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118, v119, v120, v121, v122);
+  }
+};
+
+template <>
+struct tie_struct_t<123> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118, v119, v120, v121,
+           v122, v123] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118, v119, v120, v121, v122, v123);
+  }
+};
+
+template <>
+struct tie_struct_t<124> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118, v119, v120, v121,
+           v122, v123, v124] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118, v119, v120, v121, v122, v123, v124);
+  }
+};
+
+template <>
+struct tie_struct_t<125> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118, v119, v120, v121,
+           v122, v123, v124, v125] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118, v119, v120, v121, v122, v123, v124, v125);
+  }
+};
+
+template <>
+struct tie_struct_t<126> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118, v119, v120, v121,
+           v122, v123, v124, v125, v126] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118, v119, v120, v121, v122, v123, v124, v125, v126);
+  }
+};
+
+template <>
+struct tie_struct_t<127> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118, v119, v120, v121,
+           v122, v123, v124, v125, v126, v127] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118, v119, v120, v121, v122, v123, v124, v125, v126, v127);
+  }
+};
+
+template <>
+struct tie_struct_t<128> {
+  template <class T>
+  static constexpr auto tie(T& v) {
+    auto& [v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15,
+           v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+           v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43,
+           v44, v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57,
+           v58, v59, v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71,
+           v72, v73, v74, v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85,
+           v86, v87, v88, v89, v90, v91, v92, v93, v94, v95, v96, v97, v98, v99,
+           v100, v101, v102, v103, v104, v105, v106, v107, v108, v109, v110,
+           v111, v112, v113, v114, v115, v116, v117, v118, v119, v120, v121,
+           v122, v123, v124, v125, v126, v127, v128] = v;
+    return flat_tie(v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14,
+      v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29,
+      v30, v31, v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44,
+      v45, v46, v47, v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59,
+      v60, v61, v62, v63, v64, v65, v66, v67, v68, v69, v70, v71, v72, v73, v74,
+      v75, v76, v77, v78, v79, v80, v81, v82, v83, v84, v85, v86, v87, v88, v89,
+      v90, v91, v92, v93, v94, v95, v96, v97, v98, v99, v100, v101, v102, v103,
+      v104, v105, v106, v107, v108, v109, v110, v111, v112, v113, v114, v115,
+      v116, v117, v118, v119, v120, v121, v122, v123, v124, v125, v126, v127,
+      v128);
+  }
+};
+// clang-format on
+
+}// namespace magic_args::detail
@@ -0,0 +1,402 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include <magic_args/incomplete_parse_reason.hpp>
+#endif
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Define `MAGIC_ARGS_DISABLE_SIMD` to always use the scalar implementations
+#ifndef MAGIC_ARGS_DISABLE_SIMD
+#if defined(__AVX2__)
+#define MAGIC_ARGS_SIMD_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) \
+  || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAGIC_ARGS_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MAGIC_ARGS_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace magic_args::detail {
+
+// UTF-16 if 16-bit, UTF-32 if 32-bit
+template <class T>
+concept wide_character = std::same_as<T, char16_t> || std::same_as<T, wchar_t>
+  || std::same_as<T, char32_t>;
+
+template <wide_character T>
+constexpr std::string_view wide_encoding_name
+  = (sizeof(T) == 2) ? "UTF-16" : "UTF-32";
+
+// Every UTF-16 code unit is at most 3 UTF-8 bytes, and surrogate pairs are 4
+// bytes; every UTF-32 code unit is at most 4 bytes
+template <wide_character T>
+constexpr std::size_t max_utf8_length(std::size_t wideLength) noexcept {
+  return wideLength * ((sizeof(T) == 2) ? 3 : 4);
+}
+
+constexpr void encode_utf8(char32_t c, char*& out) noexcept {
+  if (c < 0x80) {
+    *out++ = static_cast<char>(c);
+  } else if (c < 0x800) {
+    *out++ = static_cast<char>(0xc0 | (c >> 6));
+    *out++ = static_cast<char>(0x80 | (c & 0x3f));
+  } else if (c < 0x10000) {
+    *out++ = static_cast<char>(0xe0 | (c >> 12));
+    *out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+    *out++ = static_cast<char>(0x80 | (c & 0x3f));
+  } else {
+    *out++ = static_cast<char>(0xf0 | (c >> 18));
+    *out++ = static_cast<char>(0x80 | ((c >> 12) & 0x3f));
+    *out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+    *out++ = static_cast<char>(0x80 | (c & 0x3f));
+  }
+}
+
+// Converts the code point at `in[i]`, and advances `i` past it; returns
+// false if `in` is not valid at `i`, e.g. for an unpaired surrogate
+template <wide_character T>
+constexpr bool utf8_from_wide_code_point(
+  std::basic_string_view<T> in,
+  std::size_t& i,
+  char*& out) noexcept {
+  const auto c = static_cast<char32_t>(in[i]);
+  if constexpr (sizeof(T) == 4) {
+    if (c > 0x10ffff || (c >= 0xd800 && c <= 0xdfff)) {
+      return false;
+    }
+    encode_utf8(c, out);
+    ++i;
+    return true;
+  } else {
+    if (c < 0xd800 || c > 0xdfff) {
+      encode_utf8(c, out);
+      ++i;
+      return true;
+    }
+    if (c > 0xdbff || i + 1 == in.size()) {
+      return false;
+    }
+    const auto low = static_cast<char32_t>(in[i + 1]);
+    if (low < 0xdc00 || low > 0xdfff) {
+      return false;
+    }
+    encode_utf8(0x10000 + ((c - 0xd800) << 10) + (low - 0xdc00), out);
+    i += 2;
+    return true;
+  }
+}
+
+// `out` must have space for `max_utf8_length<T>(in.size())` bytes; returns
+// the number of bytes written.
+template <wide_character T>
+constexpr std::expected<std::size_t, incomplete_parse_reason>
+utf8_from_wide_scalar(
+  std::basic_string_view<T> in,
+  char* const out) noexcept {
+  char* it = out;
+  for (std::size_t i = 0; i < in.size();) {
+    if (!utf8_from_wide_code_point(in, i, it)) {
+      return std::unexpected {incomplete_parse_reason::InvalidEncoding};
+    }
+  }
+  return static_cast<std::size_t>(it - out);
+}
+
+#if defined(MAGIC_ARGS_SIMD_AVX2)
+constexpr std::size_t utf16_simd_width = 16;
+
+// If the next `utf16_simd_width` code units are ASCII, writes them to `out`
+inline bool ascii_from_utf16_block(const char16_t* in, char* out) noexcept {
+  const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+  if (!_mm256_testz_si256(v, _mm256_set1_epi16(static_cast<short>(0xff80)))) {
+    return false;
+  }
+  // `packus` works within 128-bit lanes; gather the low half of each lane
+  const auto packed = _mm256_permute4x64_epi64(
+    _mm256_packus_epi16(v, v), 0b1000);
+  _mm_storeu_si128(
+    reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(packed));
+  return true;
+}
+#elif defined(MAGIC_ARGS_SIMD_SSE2)
+constexpr std::size_t utf16_simd_width = 8;
+
+inline bool ascii_from_utf16_block(const char16_t* in, char* out) noexcept {
+  const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+  const auto high
+    = _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xff80)));
+  if (
+    _mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xffff) {
+    return false;
+  }
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(v, v));
+  return true;
+}
+#elif defined(MAGIC_ARGS_SIMD_NEON)
+constexpr std::size_t utf16_simd_width = 8;
+
+inline bool ascii_from_utf16_block(const char16_t* in, char* out) noexcept {
+  const auto v = vld1q_u16(reinterpret_cast<const std::uint16_t*>(in));
+  if (vmaxvq_u16(v) >= 0x80) {
+    return false;
+  }
+  vst1_u8(reinterpret_cast<std::uint8_t*>(out), vmovn_u16(v));
+  return true;
+}
+#else
+constexpr std::size_t utf16_simd_width = 0;
+
+inline bool ascii_from_utf16_block(const char16_t*, char*) noexcept {
+  return false;
+}
+#endif
+
+// Converts UTF-16 or UTF-32 to UTF-8 in a single pass, rejecting unpaired
+// surrogates and out-of-range code points.
+//
+// `out` must have space for `max_utf8_length<T>(in.size())` bytes; returns
+// the number of bytes written.
+//
+// Blocks of UTF-16 ASCII are converted with SIMD if available.
+template <wide_character T>
+std::expected<std::size_t, incomplete_parse_reason> utf8_from_wide(
+  std::basic_string_view<T> in,
+  char* const out) noexcept {
+  if constexpr (sizeof(T) != 2 || utf16_simd_width == 0) {
+    return utf8_from_wide_scalar(in, out);
+  } else {
+    constexpr auto width = utf16_simd_width;
+    const auto units = reinterpret_cast<const char16_t*>(in.data());
+    char* it = out;
+    std::size_t i = 0;
+    while (i + width <= in.size()) {
+      if (ascii_from_utf16_block(units + i, it)) {
+        i += width;
+        it += width;
+        continue;
+      }
+      // May finish past the end of the block if it ends with a surrogate pair
+      for (const auto end = i + width; i < end;) {
+        if (!utf8_from_wide_code_point(in, i, it)) {
+          return std::unexpected {incomplete_parse_reason::InvalidEncoding};
+        }
+      }
+    }
+    while (i < in.size()) {
+      if (!utf8_from_wide_code_point(in, i, it)) {
+        return std::unexpected {incomplete_parse_reason::InvalidEncoding};
+      }
+    }
+    return static_cast<std::size_t>(it - out);
+  }
+}
+
+// Validates the UTF-8 sequence starting at `in[i]`, and advances `i` past it
+constexpr bool skip_utf8_code_point(
+  std::string_view in,
+  std::size_t& i) noexcept {
+  const auto byte = [&](std::size_t offset) {
+    return static_cast<unsigned char>(in[i + offset]);
+  };
+  const auto c = byte(0);
+  if (c < 0x80) {
+    ++i;
+    return true;
+  }
+
+  // The valid range for the second byte depends on the first, to reject
+  // overlong encodings, surrogates, and values above U+10FFFF
+  std::size_t length {};
+  unsigned char low = 0x80;
+  unsigned char high = 0xbf;
+  if (c >= 0xc2 && c <= 0xdf) {
+    length = 2;
+  } else if (c >= 0xe0 && c <= 0xef) {
+    length = 3;
+    if (c == 0xe0) {
+      low = 0xa0;
+    } else if (c == 0xed) {
+      high = 0x9f;
+    }
+  } else if (c >= 0xf0 && c <= 0xf4) {
+    length = 4;
+    if (c == 0xf0) {
+      low = 0x90;
+    } else if (c == 0xf4) {
+      high = 0x8f;
+    }
+  } else {
+    return false;
+  }
+
+  if (in.size() - i < length || byte(1) < low || byte(1) > high) {
+    return false;
+  }
+  for (std::size_t offset = 2; offset < length; ++offset) {
+    if ((byte(offset) & 0xc0) != 0x80) {
+      return false;
+    }
+  }
+  i += length;
+  return true;
+}
+
+constexpr bool is_valid_utf8_scalar(std::string_view in) noexcept {
+  for (std::size_t i = 0; i < in.size();) {
+    if (!skip_utf8_code_point(in, i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+#if defined(MAGIC_ARGS_SIMD_AVX2)
+constexpr std::size_t utf8_simd_width = 32;
+
+// True if the next `utf8_simd_width` bytes are ASCII
+inline bool is_ascii_utf8_block(const char* in) noexcept {
+  return _mm256_movemask_epi8(
+           _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in)))
+    == 0;
+}
+#elif defined(MAGIC_ARGS_SIMD_SSE2)
+constexpr std::size_t utf8_simd_width = 16;
+
+inline bool is_ascii_utf8_block(const char* in) noexcept {
+  return _mm_movemask_epi8(
+           _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)))
+    == 0;
+}
+#elif defined(MAGIC_ARGS_SIMD_NEON)
+constexpr std::size_t utf8_simd_width = 16;
+
+inline bool is_ascii_utf8_block(const char* in) noexcept {
+  return vmaxvq_u8(vld1q_u8(reinterpret_cast<const std::uint8_t*>(in)))
+    < 0x80;
+}
+#else
+// Without SIMD, check 8 bytes at a time in a `std::uint64_t`
+constexpr std::size_t utf8_simd_width = 8;
+
+inline bool is_ascii_utf8_block(const char* in) noexcept {
+  std::uint64_t block {};
+  std::memcpy(&block, in, sizeof(block));
+  return (block & 0x8080'8080'8080'8080) == 0;
+}
+#endif
+
+// Skips blocks of ASCII with SIMD, if available; other code points are
+// validated one at a time
+inline bool is_valid_utf8(std::string_view in) noexcept {
+  constexpr auto width = utf8_simd_width;
+  std::size_t i = 0;
+  while (i + width <= in.size()) {
+    if (is_ascii_utf8_block(in.data() + i)) {
+      i += width;
+      continue;
+    }
+    // May finish past the end of the block if a sequence crosses it
+    for (const auto end = i + width; i < end;) {
+      if (!skip_utf8_code_point(in, i)) {
+        return false;
+      }
+    }
+  }
+  // `i` is at the start of a code point, so if the last block is ASCII, so is
+  // everything from `i`
+  if (
+    i < in.size() && in.size() >= width
+    && is_ascii_utf8_block(in.data() + in.size() - width)) {
+    return true;
+  }
+  while (i < in.size()) {
+    if (!skip_utf8_code_point(in, i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// UTF-8 arguments converted from another encoding; `mArgs` refer to
+// `mBuffer`
+struct transcoded_arguments {
+  std::unique_ptr<char[]> mBuffer;
+  std::vector<std::string_view> mArgs;
+};
+
+template <class T>
+struct argument_char {};
+
+template <class T>
+  requires requires { typename T::value_type; }
+struct argument_char<T> {
+  using type = typename T::value_type;
+};
+
+template <class T>
+struct argument_char<T*> {
+  using type = std::remove_const_t<T>;
+};
+
+template <class R>
+using argument_char_t =
+  typename argument_char<std::remove_cv_t<std::ranges::range_value_t<R>>>::type;
+
+// Any sized range of UTF-16 or UTF-32 strings, e.g. `wmain()`'s `argv`
+template <class R>
+concept wide_argument_range = std::ranges::sized_range<R>
+  && requires { typename argument_char_t<R>; }
+  && wide_character<argument_char_t<R>>
+  && std::convertible_to<
+    std::ranges::range_reference_t<const R>,
+    std::basic_string_view<argument_char_t<R>>>;
+
+// Converts all of `args` to UTF-8, in a single buffer.
+//
+// On failure, the error is the index of the invalid argument, and `out`
+// contains the arguments before it.
+template <wide_argument_range R>
+std::expected<void, std::size_t> transcode_arguments(
+  const R& args,
+  transcoded_arguments& out) {
+  using T = argument_char_t<R>;
+  const auto view
+    = [](const auto& arg) { return std::basic_string_view<T> {arg}; };
+
+  std::size_t length = 0;
+  for (auto&& arg: args) {
+    length += max_utf8_length<T>(view(arg).size());
+  }
+  out.mBuffer = std::make_unique_for_overwrite<char[]>(length);
+  out.mArgs.clear();
+  out.mArgs.reserve(std::ranges::size(args));
+
+  char* it = out.mBuffer.get();
+  for (auto&& arg: args) {
+    const auto written = utf8_from_wide(view(arg), it);
+    if (!written) {
+      return std::unexpected {out.mArgs.size()};
+    }
+    out.mArgs.emplace_back(it, *written);
+    it += *written;
+  }
+  return {};
+}
+
+}// namespace magic_args::detail
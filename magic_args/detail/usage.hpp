@@ -6,171 +6,233 @@
 #include <magic_args/gnu_style_parsing_traits.hpp>
 #include <magic_args/program_info.hpp>
 
-#include "concepts.hpp"
+#include "argument_descriptor.hpp"
+#include "parser_descriptor.hpp"
 #include "print.hpp"
 #endif
 
+#include <algorithm>
+#include <cctype>
 #include <cstdio>
-#include <filesystem>
+#include <format>
+#include <iterator>
 #include <string>
+#include <string_view>
+#include <utility>
 
 namespace magic_args::detail {
 
-template <class Traits, class TArg>
-void show_option_usage(FILE*, const TArg&) {
+// Equivalent to `std::filesystem::path {argv0}.stem()`, without including
+// `<filesystem>`
+constexpr std::string_view program_name(std::string_view argv0) noexcept {
+#ifdef _WIN32
+  constexpr std::string_view separators {"/\\:"};
+#else
+  constexpr std::string_view separators {"/"};
+#endif
+  if (const auto it = argv0.find_last_of(separators);
+      it != std::string_view::npos) {
+    argv0.remove_prefix(it + 1);
+  }
+  if (argv0 == "..") {
+    return argv0;
+  }
+  // Leading dots are part of the stem, e.g. `.hidden`
+  if (const auto it = argv0.rfind('.');
+      it != std::string_view::npos && it > 0) {
+    argv0.remove_suffix(argv0.size() - it);
+  }
+  return argv0;
 }
 
-template <class Traits, basic_option TArg>
-void show_option_usage(FILE* output, const TArg& arg) {
-  const auto shortArg = [&arg] {
-    if constexpr (requires {
-                    arg.mShortName;
-                    Traits::short_arg_prefix;
-                  }) {
-      if (!arg.mShortName.empty()) {
-        return std::format("{}{},", Traits::short_arg_prefix, arg.mShortName);
-      }
-    }
-    return std::string {};
-  }();
-
-  const auto longArg = [&arg] {
-    const std::string name
-      = std::format("{}{}", Traits::long_arg_prefix, arg.mName);
-    if constexpr (std::same_as<std::decay_t<decltype(arg)>, flag>) {
-      return name;
-    } else {
-      return std::format("{}{}VALUE", name, Traits::value_separator);
-    }
-  }();
+// Usage is either appended to a string, so that it can be reused, or printed
+// directly
+template <class... Args>
+void usage_print(
+  std::string& out,
+  std::format_string<Args...> fmt,
+  Args&&... args) {
+  std::format_to(std::back_inserter(out), fmt, std::forward<Args>(args)...);
+}
+
+template <class... Args>
+void usage_print(FILE* out, std::format_string<Args...> fmt, Args&&... args) {
+  detail::print(out, fmt, std::forward<Args>(args)...);
+}
+
+template <class Output>
+void write_option_usage(
+  Output& out,
+  const parsing_style& style,
+  std::string_view name,
+  std::string_view help,
+  std::string_view shortName,
+  bool takesValue) {
+  std::string shortArg;
+  if (!(shortName.empty() || style.mShortArgPrefix.empty())) {
+    shortArg = std::format("{}{},", style.mShortArgPrefix, shortName);
+  }
+
+  auto longArg = std::format("{}{}", style.mLongArgPrefix, name);
+  if (takesValue) {
+    longArg = std::format("{}{}VALUE", longArg, style.mValueSeparator);
+  }
 
   const auto params = std::format("  {:3} {}", shortArg, longArg);
-  if (arg.mHelp.empty()) {
-    detail::println(output, "{}", params);
+  if (help.empty()) {
+    usage_print(out, "{}\n", params);
     return;
   }
 
   if (params.size() < 30) {
-    detail::println(output, "{:30} {}", params, arg.mHelp);
+    usage_print(out, "{:30} {}\n", params, help);
     return;
   }
-  detail::println(output, "{}\n{:31}{}", params, "", arg.mHelp);
-}
-
-template <class Traits, basic_option T>
-void show_positional_argument_usage(FILE*, const T&) {
+  usage_print(out, "{}\n{:31}{}\n", params, "", help);
 }
 
-template <class Traits, basic_argument T>
-  requires(!basic_option<T>)
-void show_positional_argument_usage(FILE* output, const T& arg) {
+template <class Output>
+void write_positional_argument_usage(
+  Output& out,
+  const argument_descriptor& arg) {
   if (arg.mHelp.empty()) {
-    detail::println(output, "      {}", arg.mName);
+    usage_print(out, "      {}\n", arg.mName);
     return;
   }
-  detail::println(output, "      {:25}{}", arg.mName, arg.mHelp);
+  usage_print(out, "      {:25}{}\n", arg.mName, arg.mHelp);
 }
 
-template <class T, class Traits = gnu_style_parsing_traits>
-void show_usage(
-  FILE* output,
-  std::string_view argv0,
-  const program_info& extraHelp = {}) {
-  using namespace detail;
-  constexpr auto N = count_members<T>();
-
-  constexpr bool hasOptions = []<std::size_t... I>(std::index_sequence<I...>) {
-    return (
-      basic_option<decltype(get_argument_definition<T, I, Traits>())> || ...);
-  }(std::make_index_sequence<N> {});
-  constexpr bool hasPositionalArguments
-    = []<std::size_t... I>(std::index_sequence<I...>) {
-        return (
-          (basic_argument<decltype(get_argument_definition<T, I, Traits>())>
-           && !basic_option<decltype(get_argument_definition<T, I, Traits>())>)
-          || ...);
-      }(std::make_index_sequence<N> {});
-
-  const auto oneLiner = std::format(
-    "Usage: {} [OPTIONS...]", std::filesystem::path {argv0}.stem().string());
-  if constexpr (!hasPositionalArguments) {
-    detail::println(output, "{}", oneLiner);
-  } else {
-    detail::print(output, "{} [--]", oneLiner);
-    []<std::size_t... I>(auto output, std::index_sequence<I...>) {
-      (
-        [&] {
-          const auto arg = get_argument_definition<T, I, Traits>();
-          using TArg = std::decay_t<decltype(arg)>;
-          if constexpr (!(basic_option<TArg> || std::same_as<TArg, flag>)) {
-            auto name = arg.mName;
-            for (auto&& c: name) {
-              c = static_cast<char>(std::toupper(c));
-            }
-            if (name.back() == 'S') {
-              // Real de-pluralization requires a lookup database; we can't do
-              // that, so this seems to be the only practical approach. If
-              // it's not good enough for you, specify a
-              // `positional_argument<T>` and provide a name.
-              name.pop_back();
-            }
-            if constexpr (vector_like<typename TArg::value_type>) {
-              name = std::format("{0} [{0} [...]]", name);
-            }
-            if (TArg::is_required) {
-              detail::print(output, " {}", name);
-            } else {
-              detail::print(output, " [{}]", name);
-            }
-          }
-        }(),
-        ...);
-    }(output, std::make_index_sequence<N> {});
-    detail::println(output, "");
+// Everything after `Usage: PROGRAM_NAME`; this does not depend on `argv0`, so
+// it can be formatted once and reused
+template <class Output>
+void write_usage(
+  Output& out,
+  const program_info& extraHelp,
+  const parser_descriptor& parser) {
+  const auto& style = parser.mStyle;
+  const auto& arguments = parser.mArguments;
+  const bool hasOptions
+    = std::ranges::any_of(arguments, &argument_descriptor::is_option);
+  const bool hasPositionalArguments = !std::ranges::all_of(
+    arguments, &argument_descriptor::is_option);
+
+  usage_print(out, " [OPTIONS...]");
+  if (hasPositionalArguments) {
+    usage_print(out, " [--]");
+    for (auto&& arg: arguments) {
+      if (arg.is_option()) {
+        continue;
+      }
+      std::string name {arg.mName};
+      for (auto&& c: name) {
+        c = static_cast<char>(std::toupper(c));
+      }
+      if (name.back() == 'S') {
+        // Real de-pluralization requires a lookup database; we can't do
+        // that, so this seems to be the only practical approach. If
+        // it's not good enough for you, specify a
+        // `positional_argument<T>` and provide a name.
+        name.pop_back();
+      }
+      if (arg.mMultipleValues) {
+        name = std::format("{0} [{0} [...]]", name);
+      }
+      if (arg.mKind == argument_kind::MandatoryPositional) {
+        usage_print(out, " {}", name);
+      } else {
+        usage_print(out, " [{}]", name);
+      }
+    }
   }
+  usage_print(out, "\n");
 
   if (!extraHelp.mDescription.empty()) {
-    detail::println(output, "{}", extraHelp.mDescription);
+    usage_print(out, "{}\n", extraHelp.mDescription);
   }
 
   if (!extraHelp.mExamples.empty()) {
-    detail::print(output, "\nExamples:\n\n");
+    usage_print(out, "\nExamples:\n\n");
     for (auto&& example: extraHelp.mExamples) {
-      detail::println(output, "  {}", example);
+      usage_print(out, "  {}\n", example);
     }
   }
 
-  detail::print(output, "\nOptions:\n\n");
+  usage_print(out, "\nOptions:\n\n");
   if (hasOptions) {
-    [output]<std::size_t... I>(std::index_sequence<I...>) {
-      (show_option_usage<Traits>(
-         output, get_argument_definition<T, I, Traits>()),
-       ...);
-    }(std::make_index_sequence<N> {});
-    detail::print(output, "\n");
+    for (auto&& arg: arguments) {
+      if (arg.is_option()) {
+        write_option_usage(
+          out,
+          style,
+          arg.mName,
+          arg.mHelp,
+          arg.mShortName,
+          arg.mKind == argument_kind::Option);
+      }
+    }
+    usage_print(out, "\n");
   }
 
-  if constexpr (requires { Traits::short_help_arg; }) {
-    show_option_usage<Traits>(
-      output,
-      flag {
-        Traits::long_help_arg, "show this message", Traits::short_help_arg});
-  } else {
-    show_option_usage<Traits>(
-      output, flag {Traits::long_help_arg, "show this message"});
-  }
+  write_option_usage(
+    out,
+    style,
+    style.mLongHelpArg,
+    "show this message",
+    style.mShortHelpArg,
+    false);
   if (!extraHelp.mVersion.empty()) {
-    show_option_usage<Traits>(
-      output, flag {Traits::version_arg, "print program version"});
+    write_option_usage(
+      out, style, style.mVersionArg, "print program version", {}, false);
   }
 
   if (hasPositionalArguments) {
-    detail::print(output, "\nArguments:\n\n");
-    [output]<std::size_t... I>(std::index_sequence<I...>) {
-      (show_positional_argument_usage<Traits>(
-         output, get_argument_definition<T, I, Traits>()),
-       ...);
-    }(std::make_index_sequence<N> {});
+    usage_print(out, "\nArguments:\n\n");
+    for (auto&& arg: arguments) {
+      if (!arg.is_option()) {
+        write_positional_argument_usage(out, arg);
+      }
+    }
   }
 }
-}// namespace magic_args::detail
\ No newline at end of file
+
+inline std::string format_usage(
+  const program_info& extraHelp,
+  const parser_descriptor& parser) {
+  std::string ret;
+  write_usage(ret, extraHelp, parser);
+  return ret;
+}
+
+// `formattedUsage` is from `format_usage()`
+inline void show_usage(
+  FILE* output,
+  std::string_view argv0,
+  std::string_view formattedUsage) {
+  detail::print(output, "Usage: {}{}", program_name(argv0), formattedUsage);
+}
+
+// `formattedUsage` is from `format_usage(extraHelp, parser)`, or empty to
+// print the usage directly, without formatting it into a string first
+inline void show_usage(
+  FILE* output,
+  std::string_view argv0,
+  const program_info& extraHelp,
+  const parser_descriptor& parser,
+  std::string_view formattedUsage = {}) {
+  if (!formattedUsage.empty()) {
+    show_usage(output, argv0, formattedUsage);
+    return;
+  }
+  detail::print(output, "Usage: {}", program_name(argv0));
+  write_usage(output, extraHelp, parser);
+}
+
+template <class T, class Traits = gnu_style_parsing_traits>
+void show_usage(
+  FILE* output,
+  std::string_view argv0,
+  const program_info& extraHelp = {}) {
+  show_usage(output, argv0, extraHelp, get_parser_descriptor<T, Traits>());
+}
+
+}// namespace magic_args::detail
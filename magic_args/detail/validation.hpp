@@ -12,14 +12,17 @@ namespace magic_args::detail {
 template <class T, std::size_t I = 0>
 constexpr bool only_last_positional_argument_may_have_multiple_values() {
   // Doesn't matter for this check, but we need some traits for
-  // get_argument_definition
+  // argument_definition_t
   using Traits = gnu_style_parsing_traits;
 
   constexpr auto N = count_members<T>();
   if constexpr (I == N) {
     return true;
-  } else if constexpr (vector_like<
-                         decltype(get_argument_definition<T, I, Traits>())>) {
+  } else if constexpr (
+    basic_argument<argument_definition_t<T, I, Traits>>
+    && !basic_option<argument_definition_t<T, I, Traits>>
+    && multiple_values<
+      typename argument_definition_t<T, I, Traits>::value_type>) {
     return I == N - 1;
   } else {
     return only_last_positional_argument_may_have_multiple_values<T, I + 1>();
@@ -35,8 +38,7 @@ constexpr std::ptrdiff_t last_mandatory_positional_argument() {
     return -1;
   } else {
     const auto recurse = last_mandatory_positional_argument<T, I + 1>();
-    using TArg
-      = std::decay_t<decltype(get_argument_definition<T, I, Traits>())>;
+    using TArg = argument_definition_t<T, I, Traits>;
     if constexpr (requires { TArg::is_required; }) {
       if constexpr (recurse == -1 && TArg::is_required) {
         return I;
@@ -53,8 +55,7 @@ constexpr std::ptrdiff_t first_optional_positional_argument() {
   if constexpr (I == N) {
     return -1;
   } else {
-    using TArg
-      = std::decay_t<decltype(get_argument_definition<T, I, Traits>())>;
+    using TArg = argument_definition_t<T, I, Traits>;
     if constexpr (requires { TArg::is_required; }) {
       if (!TArg::is_required) {
         return I;
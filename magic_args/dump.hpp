@@ -32,6 +32,20 @@ std::string formattable_argument_value(const std::vector<T>& arg) {
   return std::format("[{}]", result);
 }
 
+template <argument_range T>
+  requires std::formattable<typename T::value_type, char>
+std::string formattable_argument_value(const T& arg) {
+  std::string result;
+  for (auto&& v: arg) {
+    if (result.empty()) {
+      result = std::format("`{}`", v);
+    } else {
+      result = std::format("{}, `{}`", result, v);
+    }
+  }
+  return std::format("[{}]", result);
+}
+
 template <class T>
 std::string formattable_argument_value(const std::optional<T>& arg)
   requires requires { formattable_argument_value(arg.value()); }
@@ -68,7 +82,7 @@ void dump(const T& args, FILE* output = stdout) {
      ...);
   }(tuple,
     output,
-    std::make_index_sequence<std::tuple_size_v<decltype(tuple)>> {});
+    std::make_index_sequence<count_members<T>()> {});
 }
 
 }// namespace magic_args::inline public_api
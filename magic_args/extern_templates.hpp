@@ -0,0 +1,143 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include "argument_view.hpp"
+#include "dump.hpp"
+#include "incomplete_parse_reason.hpp"
+#include "parse.hpp"
+#include "program_info.hpp"
+#endif
+
+#include <cstdio>
+#include <expected>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+
+// Explicit instantiation of `parse<T, Traits>()` and usage, so that a struct
+// that is shared between translation units is only compiled once, e.g.:
+//
+//   // my_args.hpp
+//   struct MyArgs { ... };
+//   MAGIC_ARGS_DECLARE_PARSER(MyArgs, magic_args::gnu_style_parsing_traits);
+//   MAGIC_ARGS_DECLARE_DUMP(MyArgs);
+//
+//   // my_args.cpp
+//   #include "my_args.hpp"
+//   MAGIC_ARGS_DEFINE_PARSER(MyArgs, magic_args::gnu_style_parsing_traits);
+//   MAGIC_ARGS_DEFINE_DUMP(MyArgs);
+//
+// `Traits` is required, even if it is the default; it can contain commas.
+//
+// These must be used in the global namespace. They cover `parse()` and
+// `parse_into()` with `argc` and `argv` or any other contiguous range of UTF-8
+// arguments, with or without a `std::pmr::memory_resource*`, and `parse()`
+// with `wmain()` arguments; other UTF-16 and UTF-32 ranges, and the
+// `windows.hpp` extensions, are still instantiated where they are used.
+//
+// As `wmain()` arguments are copied, `T` can not have `std::string_view`
+// members; see `detail::has_argument_views()`.
+#define MAGIC_ARGS_DECLARE_PARSER(T, ...) \
+  MAGIC_ARGS_DETAIL_PARSER_INSTANTIATIONS(extern template, T, __VA_ARGS__)
+#define MAGIC_ARGS_DEFINE_PARSER(T, ...) \
+  MAGIC_ARGS_DETAIL_PARSER_INSTANTIATIONS(template, T, __VA_ARGS__)
+
+// `dump<T>()` does not depend on `Traits`, so it is instantiated separately
+#define MAGIC_ARGS_DECLARE_DUMP(T) \
+  extern template void ::magic_args::dump<T>(const T&, FILE*)
+#define MAGIC_ARGS_DEFINE_DUMP(T) \
+  template void ::magic_args::dump<T>(const T&, FILE*)
+
+// Trailing return types, as `std::expected<...> ::magic_args::parse` would be
+// parsed as a member of `std::expected<...>`
+#define MAGIC_ARGS_DETAIL_PARSER_INSTANTIATIONS(PREFIX, T, ...) \
+  PREFIX auto ::magic_args::parse<T, __VA_ARGS__>( \
+    ::magic_args::argument_view, \
+    const ::magic_args::program_info&, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<T, ::magic_args::incomplete_parse_reason>; \
+  PREFIX auto ::magic_args::parse<T, __VA_ARGS__>( \
+    int, \
+    const char* const*, \
+    const ::magic_args::program_info&, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<T, ::magic_args::incomplete_parse_reason>; \
+  PREFIX auto ::magic_args::parse<T, __VA_ARGS__>( \
+    int, \
+    const wchar_t* const*, \
+    const ::magic_args::program_info&, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<T, ::magic_args::incomplete_parse_reason>; \
+  PREFIX auto ::magic_args::parse<T, __VA_ARGS__>( \
+    std::pmr::memory_resource*, \
+    ::magic_args::argument_view, \
+    const ::magic_args::program_info&, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<T, ::magic_args::incomplete_parse_reason>; \
+  PREFIX auto ::magic_args::parse<T, __VA_ARGS__>( \
+    std::pmr::memory_resource*, \
+    int, \
+    const char* const*, \
+    const ::magic_args::program_info&, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<T, ::magic_args::incomplete_parse_reason>; \
+  PREFIX auto ::magic_args::detail::parse<T, __VA_ARGS__>( \
+    ::magic_args::argument_view, \
+    std::shared_ptr<const void>, \
+    std::pmr::memory_resource*, \
+    const ::magic_args::program_info&, \
+    std::string_view, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<T, ::magic_args::incomplete_parse_reason>; \
+  PREFIX auto ::magic_args::parse_into<T, __VA_ARGS__>( \
+    T&, \
+    ::magic_args::argument_view, \
+    const ::magic_args::program_info&, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<void, ::magic_args::incomplete_parse_reason>; \
+  PREFIX auto ::magic_args::parse_into<T, __VA_ARGS__>( \
+    T&, \
+    int, \
+    const char* const*, \
+    const ::magic_args::program_info&, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<void, ::magic_args::incomplete_parse_reason>; \
+  PREFIX auto ::magic_args::parse_into<T, __VA_ARGS__>( \
+    std::pmr::memory_resource*, \
+    T&, \
+    ::magic_args::argument_view, \
+    const ::magic_args::program_info&, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<void, ::magic_args::incomplete_parse_reason>; \
+  PREFIX auto ::magic_args::parse_into<T, __VA_ARGS__>( \
+    std::pmr::memory_resource*, \
+    T&, \
+    int, \
+    const char* const*, \
+    const ::magic_args::program_info&, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<void, ::magic_args::incomplete_parse_reason>; \
+  PREFIX auto ::magic_args::detail::parse_into<T, __VA_ARGS__>( \
+    T&, \
+    ::magic_args::argument_view, \
+    std::shared_ptr<const void>, \
+    std::pmr::memory_resource*, \
+    const ::magic_args::program_info&, \
+    std::string_view, \
+    FILE*, \
+    FILE*) \
+    ->std::expected<void, ::magic_args::incomplete_parse_reason>; \
+  PREFIX void ::magic_args::detail::show_usage<T, __VA_ARGS__>( \
+    FILE*, std::string_view, const ::magic_args::program_info&)
@@ -12,6 +12,8 @@ enum class incomplete_parse_reason {
   InvalidArgument,
   InvalidArgumentValue,
   InvalidEncoding,
+  AmbiguousArgument,
+  InvalidResponseFile,
 };
 using enum incomplete_parse_reason;
 
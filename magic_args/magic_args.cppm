@@ -0,0 +1,88 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+//
+// `import magic_args;`
+//
+// This exports the same API as including <magic_args/magic_args.hpp>, with
+// response files enabled, and the Windows extensions enabled on Windows.
+//
+// Customization points such as `from_string_argument()` are found by
+// argument-dependent lookup, so they do not need to be exported; define them
+// next to your types as usual.
+//
+// Only the public API is exported, so `using namespace magic_args;` is
+// equivalent to `using namespace magic_args::public_api;` with the headers.
+module;
+
+#define MAGIC_ARGS_ENABLE_RESPONSE_FILES
+#ifdef _WIN32
+#define MAGIC_ARGS_ENABLE_WINDOWS_EXTENSIONS
+#endif
+
+#include <magic_args/magic_args.hpp>
+
+export module magic_args;
+
+export namespace magic_args {
+
+// argument_definitions.hpp
+using magic_args::counted_flag;
+using magic_args::flag;
+using magic_args::mandatory_positional_argument;
+using magic_args::option;
+using magic_args::optional_positional_argument;
+
+// argument_view.hpp
+using magic_args::argument_view;
+
+// command_line.hpp
+using magic_args::command_line_arguments;
+
+// detail/concepts.hpp
+using magic_args::basic_argument;
+using magic_args::basic_option;
+
+// dump.hpp
+using magic_args::dump;
+
+// gnu_style_parsing_traits.hpp, powershell_style_parsing_traits.hpp
+using magic_args::gnu_style_parsing_traits;
+using magic_args::powershell_style_parsing_traits;
+
+// incomplete_parse_reason.hpp
+using magic_args::incomplete_parse_reason;
+using magic_args::AmbiguousArgument;
+using magic_args::HelpRequested;
+using magic_args::InvalidArgument;
+using magic_args::InvalidArgumentValue;
+using magic_args::InvalidEncoding;
+using magic_args::InvalidResponseFile;
+using magic_args::MissingArgumentValue;
+using magic_args::MissingRequiredArgument;
+using magic_args::VersionRequested;
+
+// parse.hpp, windows.hpp
+using magic_args::parse;
+using magic_args::parse_into;
+
+// parser.hpp
+using magic_args::parser;
+
+// positional_argument_range.hpp
+using magic_args::positional_argument_range;
+
+// program_info.hpp
+using magic_args::program_info;
+
+// Traits decorators
+using magic_args::response_file_syntax;
+using magic_args::response_files;
+using magic_args::strict_utf8;
+using magic_args::unambiguous_prefixes;
+using magic_args::verbatim_names;
+
+#ifdef MAGIC_ARGS_ENABLE_WINDOWS_EXTENSIONS
+using magic_args::attach_to_parent_terminal;
+#endif
+
+}// namespace magic_args
@@ -2,14 +2,24 @@
 // SPDX-License-Identifier: MIT
 
 #ifndef MAGIC_ARGS_SINGLE_FILE
+#include "command_line.hpp"
 #include "dump.hpp"
+#include "extern_templates.hpp"
 #include "gnu_style_parsing_traits.hpp"
 #include "parse.hpp"
+#include "parser.hpp"
+#include "positional_argument_range.hpp"
 #include "powershell_style_parsing_traits.hpp"
+#include "strict_utf8.hpp"
+#include "unambiguous_prefixes.hpp"
 #include "verbatim_names.hpp"
 
 #ifdef MAGIC_ARGS_ENABLE_WINDOWS_EXTENSIONS
 #include "windows.hpp"
 #endif
 
+#ifdef MAGIC_ARGS_ENABLE_RESPONSE_FILES
+#include "response_files.hpp"
+#endif
+
 #endif
\ No newline at end of file
@@ -3,9 +3,10 @@
 #pragma once
 
 #ifndef MAGIC_ARGS_SINGLE_FILE
-#include "detail/get_argument_definition.hpp"
+#include "argument_view.hpp"
 #include "detail/parse.hpp"
-#include "detail/reflection.hpp"
+#include "detail/parser_descriptor.hpp"
+#include "detail/unicode.hpp"
 #include "detail/usage.hpp"
 #include "detail/validation.hpp"
 #include "gnu_style_parsing_traits.hpp"
@@ -13,181 +14,329 @@
 #endif
 
 #include <expected>
-#include <filesystem>
 #include <format>
+#include <memory>
+#include <memory_resource>
 #include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace magic_args::detail {
+
+// `out` must be default-initialized, or reset with `reset_to_default()`
+//
+// `argsOwner` keeps `args` alive, if they are not owned by the caller of
+// `parse()`; it is shared with any `positional_argument_range<>` in the result
+//
+// Temporary copies of positional arguments are allocated from `resource`, or
+// `std::pmr::get_default_resource()` if it is null
+//
+// Only response files are handled here; everything else is done by the
+// non-template `parse_arguments()`, using `get_parser_descriptor<T, Traits>()`
+//
+// `formattedUsage` is from `format_usage()`, or empty to format the usage only
+// if it is shown
+template <class T, class Traits>
+std::expected<void, incomplete_parse_reason> parse_into(
+  T& out,
+  argument_view args,
+  std::shared_ptr<const void> argsOwner,
+  std::pmr::memory_resource* resource,
+  const program_info& help,
+  std::string_view formattedUsage,
+  FILE* outputStream,
+  FILE* errorStream) {
+  static_assert(only_last_positional_argument_may_have_multiple_values<T>());
+  static_assert(
+    (first_optional_positional_argument<T>() == -1)
+    || (first_optional_positional_argument<T>() >= last_mandatory_positional_argument<T>()));
+
+  const auto& parser = get_parser_descriptor<T, Traits>();
+  if constexpr (expands_response_files<Traits>) {
+    static_assert(
+      !has_argument_views<T>(),
+      "Response files are freed when parse() returns; use std::string or "
+      "positional_argument_range<std::string_view> instead of "
+      "std::string_view");
+    const auto expanded
+      = Traits::expand_response_files(argsOwner, args, errorStream);
+    if (!expanded) {
+      detail::println(errorStream, "");
+      show_usage(errorStream, args.front(), help, parser, formattedUsage);
+      return std::unexpected {expanded.error()};
+    }
+    args = *expanded;
+  }
+
+  if (const auto failure = parse_arguments(
+        &out,
+        parser,
+        args,
+        std::move(argsOwner),
+        resource,
+        help,
+        formattedUsage,
+        outputStream,
+        errorStream)) {
+    return std::unexpected {*failure};
+  }
+  return {};
+}
+
+// If `resource` is not null, allocator-aware members of the result are also
+// re-created with it
+template <class T, class Traits>
+std::expected<T, incomplete_parse_reason> parse(
+  argument_view args,
+  std::shared_ptr<const void> argsOwner,
+  std::pmr::memory_resource* resource,
+  const program_info& help,
+  std::string_view formattedUsage,
+  FILE* outputStream,
+  FILE* errorStream) {
+  T ret {};
+  if (resource) {
+    use_memory_resource(ret, resource);
+  }
+  if (const auto parsed = parse_into<T, Traits>(
+        ret,
+        args,
+        std::move(argsOwner),
+        resource,
+        help,
+        formattedUsage,
+        outputStream,
+        errorStream);
+      !parsed) {
+    return std::unexpected {parsed.error()};
+  }
+  return ret;
+}
+
+// Converts `args` to UTF-8, then parses them
+template <class T, class Traits, wide_argument_range R>
+std::expected<T, incomplete_parse_reason> parse_wide(
+  const R& args,
+  const program_info& help,
+  std::string_view formattedUsage,
+  FILE* outputStream,
+  FILE* errorStream) {
+  static_assert(
+    !has_argument_views<T>(),
+    "Converted arguments are freed when parse() returns; use std::string or "
+    "positional_argument_range<std::string_view> instead of std::string_view");
+  constexpr auto encoding = wide_encoding_name<argument_char_t<R>>;
+  // Shared with any `positional_argument_range<>` in the result
+  const auto transcoded = std::make_shared<transcoded_arguments>();
+  if (const auto valid = transcode_arguments(args, *transcoded); !valid) {
+    const auto index = valid.error();
+    if (index == 0) {
+      detail::println(
+        errorStream, "The program name is not valid {}", encoding);
+    } else {
+      const auto argv0 = transcoded->mArgs.front();
+      detail::print(
+        errorStream,
+        "{}: Argument {} is not valid {}\n\n",
+        program_name(argv0),
+        index,
+        encoding);
+      show_usage(
+        errorStream,
+        argv0,
+        help,
+        get_parser_descriptor<T, Traits>(),
+        formattedUsage);
+    }
+    return std::unexpected {incomplete_parse_reason::InvalidEncoding};
+  }
+  return parse<T, Traits>(
+    transcoded->mArgs,
+    transcoded,
+    nullptr,
+    help,
+    formattedUsage,
+    outputStream,
+    errorStream);
+}
+
+}// namespace magic_args::detail
 
 namespace magic_args::inline public_api {
 
 template <class T, class Traits = gnu_style_parsing_traits>
 std::expected<T, incomplete_parse_reason> parse(
-  std::span<std::string_view> args,
+  argument_view args,
   const program_info& help = {},
   FILE* outputStream = stdout,
   FILE* errorStream = stderr) {
-  using namespace detail;
-
-  const auto longHelp
-    = std::format("{}{}", Traits::long_arg_prefix, Traits::long_help_arg);
-  const auto shortHelp = [] {
-    if constexpr (requires {
-                    Traits::short_help_arg;
-                    Traits::short_arg_prefix;
-                  }) {
-      return std::format(
-        "{}{}", Traits::short_arg_prefix, Traits::short_help_arg);
-    } else {
-      return std::string {};
-    }
-  }();
-  const auto versionArg
-    = std::format("{}{}", Traits::long_arg_prefix, Traits::version_arg);
+  return detail::parse<T, Traits>(
+    args, nullptr, nullptr, help, {}, outputStream, errorStream);
+}
 
-  for (auto&& arg: args) {
-    if (arg == "--") {
-      break;
-    }
-    if (arg == longHelp || (arg == shortHelp && !shortHelp.empty())) {
-      show_usage<T, Traits>(outputStream, args.front(), help);
-      return std::unexpected {incomplete_parse_reason::HelpRequested};
-    }
-    if (arg == versionArg && !help.mVersion.empty()) {
-      detail::println(outputStream, "{}", help.mVersion);
-      return std::unexpected {incomplete_parse_reason::VersionRequested};
-    }
-  }
+// `argv` is not copied; any `positional_argument_range<>` in the result refers
+// to it directly
+template <class T, class Traits = gnu_style_parsing_traits>
+std::expected<T, incomplete_parse_reason> parse(
+  int argc,
+  const char* const* argv,
+  const program_info& help = {},
+  FILE* outputStream = stdout,
+  FILE* errorStream = stderr) {
+  return parse<T, Traits>(
+    std::span {argv, static_cast<std::size_t>(argc)},
+    help,
+    outputStream,
+    errorStream);
+}
 
-  const auto arg0 = std::filesystem::path {args.front()}.stem().string();
-  T ret {};
-  auto tuple = tie_struct(ret);
-
-  constexpr auto N = count_members<T>();
-  std::vector<std::string_view> positionalArgs;
-
-  // Handle options
-  std::optional<incomplete_parse_reason> failure;
-  for (std::size_t i = 1; i < args.size();) {
-    const auto arg = args[i];
-    if (arg == "--") {
-      std::ranges::copy(
-        args.subspan(i + 1), std::back_inserter(positionalArgs));
-      break;
-    }
+// `wmain()`-style arguments; these are converted to UTF-8 in a single buffer.
+//
+// `wchar_t` is UTF-16 on Windows, and UTF-32 on most other platforms.
+template <class T, class Traits = gnu_style_parsing_traits>
+std::expected<T, incomplete_parse_reason> parse(
+  int argc,
+  const wchar_t* const* argv,
+  const program_info& help = {},
+  FILE* outputStream = stdout,
+  FILE* errorStream = stderr) {
+  return detail::parse_wide<T, Traits>(
+    std::span {argv, static_cast<std::size_t>(argc)},
+    help,
+    {},
+    outputStream,
+    errorStream);
+}
 
-    const auto matchedOption
-      = [&]<std::size_t... I>(std::index_sequence<I...>) {
-          // returns bool: matched option
-          return ([&] {
-            const auto def = get_argument_definition<T, I, Traits>();
-            auto result = parse_option<Traits>(def, args.subspan(i));
-            if (!result) {
-              return false;
-            }
-            if (!result->has_value()) {
-              failure = result->error();
-              return true;
-            }
-            get<I>(tuple) = std::move((*result)->mValue);
-            i += (*result)->mConsumed;
-            return true;
-          }() || ...);
-        }(std::make_index_sequence<N> {});
-
-    if (failure) {
-      detail::println(errorStream, "");
-      show_usage<T, Traits>(errorStream, args.front(), help);
-      return std::unexpected {failure.value()};
-    }
-    if (matchedOption) {
-      continue;
-    }
+// Any other UTF-16 or UTF-32 arguments, e.g. `std::vector<std::u16string>`
+template <
+  class T,
+  class Traits = gnu_style_parsing_traits,
+  detail::wide_argument_range R>
+std::expected<T, incomplete_parse_reason> parse(
+  const R& args,
+  const program_info& help = {},
+  FILE* outputStream = stdout,
+  FILE* errorStream = stderr) {
+  return detail::parse_wide<T, Traits>(
+    args, help, {}, outputStream, errorStream);
+}
 
-    // Store positional parameters for later
-    [&]<std::size_t... I>(std::index_sequence<I...>) {
-    }(std::make_index_sequence<N> {});
+// Allocates from `resource` instead of the global heap, e.g. from a
+// `std::pmr::monotonic_buffer_resource`; this includes:
+//
+// - allocator-aware members of the result, e.g. `std::pmr::string` and
+//   `std::pmr::vector<std::pmr::string>`
+// - temporary copies of positional arguments, including for
+//   `positional_argument_range<>`
+//
+// `resource` must outlive the result. The global heap is still used for other
+// members, e.g. `std::string`, for default member initializers that allocate,
+// and for `--help` or error output.
+template <class T, class Traits = gnu_style_parsing_traits>
+std::expected<T, incomplete_parse_reason> parse(
+  std::pmr::memory_resource* resource,
+  argument_view args,
+  const program_info& help = {},
+  FILE* outputStream = stdout,
+  FILE* errorStream = stderr) {
+  return detail::parse<T, Traits>(
+    args, nullptr, resource, help, {}, outputStream, errorStream);
+}
 
-    if (arg.starts_with(Traits::long_arg_prefix)) {
-      detail::print(errorStream, "{}: Unrecognized option: {}\n\n", arg0, arg);
-      show_usage<T, Traits>(errorStream, args.front(), help);
-      return std::unexpected {incomplete_parse_reason::InvalidArgument};
-    }
-    if constexpr (requires { Traits::short_arg_prefix; }) {
-      // TODO: handle -abc where `a`, `b`, and `c` are all flags
-
-      // The short prefixes have other meanings, e.g.:
-      //
-      // GNU, Powershell: `-` often means 'stdout'
-      // Classic MS: '/' can mean 'root of the filesystem
-      if (
-        arg.starts_with(Traits::short_arg_prefix)
-        && arg != Traits::short_arg_prefix) {
-        detail::print(
-          errorStream, "{}: Unrecognized option: {}\n\n", arg0, arg);
-        show_usage<T, Traits>(errorStream, args.front(), help);
-        return std::unexpected {incomplete_parse_reason::InvalidArgument};
-      }
-    }
+template <class T, class Traits = gnu_style_parsing_traits>
+std::expected<T, incomplete_parse_reason> parse(
+  std::pmr::memory_resource* resource,
+  int argc,
+  const char* const* argv,
+  const program_info& help = {},
+  FILE* outputStream = stdout,
+  FILE* errorStream = stderr) {
+  return parse<T, Traits>(
+    resource,
+    std::span {argv, static_cast<std::size_t>(argc)},
+    help,
+    outputStream,
+    errorStream);
+}
 
-    positionalArgs.emplace_back(arg);
-    ++i;
-  }
+// Parses into an existing `T`, e.g. in a loop; `T` must be copy-assignable.
+//
+// Every member of `out` is first reset to its default value by copy
+// assignment, which keeps the capacity of strings; strings are then converted
+// in place. The existing elements of multi-value positional arguments such as
+// `std::vector<std::string>` are assigned to, rather than destroyed. Parsing
+// similar command lines into the same `out` does not allocate. The values of
+// `std::optional` members are still allocated, as are positional arguments
+// that are mixed with options.
+//
+// If parsing fails, the values in `out` are unspecified.
+template <class T, class Traits = gnu_style_parsing_traits>
+  requires std::is_copy_assignable_v<T>
+std::expected<void, incomplete_parse_reason> parse_into(
+  T& out,
+  argument_view args,
+  const program_info& help = {},
+  FILE* outputStream = stdout,
+  FILE* errorStream = stderr) {
+  detail::reset_to_default(out);
+  return detail::parse_into<T, Traits>(
+    out, args, nullptr, nullptr, help, {}, outputStream, errorStream);
+}
 
-  // Handle positional args
-  static_assert(only_last_positional_argument_may_have_multiple_values<T>());
-  static_assert(
-    (first_optional_positional_argument<T>() == -1)
-    || (first_optional_positional_argument<T>() >= last_mandatory_positional_argument<T>()));
-  [&]<std::size_t... I>(std::index_sequence<I...>) {
-    (void)([&] {
-      // returns bool: continue
-      const auto def = get_argument_definition<T, I, Traits>();
-      auto result = parse_positional_argument<Traits>(
-        def, arg0, positionalArgs, errorStream);
-      if (!result) {
-        return true;
-      }
-      if (!result->has_value()) {
-        failure = result->error();
-        return false;
-      }
-      get<I>(tuple) = std::move((*result)->mValue);
-      positionalArgs.erase(
-        positionalArgs.begin(), positionalArgs.begin() + (*result)->mConsumed);
-      return true;
-    }() && ...);
-  }(std::make_index_sequence<N> {});
-  if (failure) {
-    detail::println(errorStream, "");
-    show_usage<T, Traits>(errorStream, args.front(), help);
-    return std::unexpected {failure.value()};
-  }
+template <class T, class Traits = gnu_style_parsing_traits>
+  requires std::is_copy_assignable_v<T>
+std::expected<void, incomplete_parse_reason> parse_into(
+  T& out,
+  int argc,
+  const char* const* argv,
+  const program_info& help = {},
+  FILE* outputStream = stdout,
+  FILE* errorStream = stderr) {
+  return parse_into<T, Traits>(
+    out,
+    std::span {argv, static_cast<std::size_t>(argc)},
+    help,
+    outputStream,
+    errorStream);
+}
 
-  if (!positionalArgs.empty()) {
-    detail::print(
-      errorStream,
-      "{}: Invalid positional argument: {}\n\n",
-      arg0,
-      positionalArgs.front());
-    show_usage<T, Traits>(errorStream, args.front(), help);
-    return std::unexpected {incomplete_parse_reason::InvalidArgument};
-  }
 
-  return ret;
+// As above, with temporary copies of positional arguments allocated from
+// `resource`. Allocator-aware members of `out` keep their existing allocators;
+// they are not re-created with `resource`.
+template <class T, class Traits = gnu_style_parsing_traits>
+  requires std::is_copy_assignable_v<T>
+std::expected<void, incomplete_parse_reason> parse_into(
+  std::pmr::memory_resource* resource,
+  T& out,
+  argument_view args,
+  const program_info& help = {},
+  FILE* outputStream = stdout,
+  FILE* errorStream = stderr) {
+  detail::reset_to_default(out);
+  return detail::parse_into<T, Traits>(
+    out, args, nullptr, resource, help, {}, outputStream, errorStream);
 }
 
 template <class T, class Traits = gnu_style_parsing_traits>
-std::expected<T, incomplete_parse_reason> parse(
+  requires std::is_copy_assignable_v<T>
+std::expected<void, incomplete_parse_reason> parse_into(
+  std::pmr::memory_resource* resource,
+  T& out,
   int argc,
-  char** argv,
+  const char* const* argv,
   const program_info& help = {},
   FILE* outputStream = stdout,
   FILE* errorStream = stderr) {
-  std::vector<std::string_view> args;
-  args.reserve(argc);
-  for (auto&& arg: std::span {argv, static_cast<std::size_t>(argc)}) {
-    args.emplace_back(arg);
-  }
-  return parse<T, Traits>(std::span {args}, help, outputStream, errorStream);
+  return parse_into<T, Traits>(
+    resource,
+    out,
+    std::span {argv, static_cast<std::size_t>(argc)},
+    help,
+    outputStream,
+    errorStream);
 }
 
 }// namespace magic_args::inline public_api
@@ -0,0 +1,171 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include "argument_view.hpp"
+#include "detail/parser_descriptor.hpp"
+#include "detail/usage.hpp"
+#include "gnu_style_parsing_traits.hpp"
+#include "incomplete_parse_reason.hpp"
+#include "parse.hpp"
+#include "program_info.hpp"
+#endif
+
+#include <cstdio>
+#include <expected>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace magic_args::inline public_api {
+
+// For parsing many command lines with the same `T`, `Traits`, and
+// `program_info`, e.g. in a server.
+//
+// The usage is formatted once, by the constructor, rather than whenever it is
+// shown. `parse()` is `const`, and can be called concurrently from multiple
+// threads.
+template <class T, class Traits = gnu_style_parsing_traits>
+class parser {
+ public:
+  explicit parser(program_info help = {})
+    : mHelp(std::move(help)),
+      mUsage(detail::format_usage(
+        mHelp,
+        detail::get_parser_descriptor<T, Traits>())) {
+  }
+
+  std::expected<T, incomplete_parse_reason> parse(
+    argument_view args,
+    FILE* outputStream = stdout,
+    FILE* errorStream = stderr) const {
+    return detail::parse<T, Traits>(
+      args, nullptr, nullptr, mHelp, mUsage, outputStream, errorStream);
+  }
+
+  // `argv` is not copied; any `positional_argument_range<>` in the result
+  // refers to it directly
+  std::expected<T, incomplete_parse_reason> parse(
+    int argc,
+    const char* const* argv,
+    FILE* outputStream = stdout,
+    FILE* errorStream = stderr) const {
+    return parse(
+      std::span {argv, static_cast<std::size_t>(argc)},
+      outputStream,
+      errorStream);
+  }
+
+  // `wmain()`-style arguments; these are converted to UTF-8 in a single
+  // buffer
+  std::expected<T, incomplete_parse_reason> parse(
+    int argc,
+    const wchar_t* const* argv,
+    FILE* outputStream = stdout,
+    FILE* errorStream = stderr) const {
+    return detail::parse_wide<T, Traits>(
+      std::span {argv, static_cast<std::size_t>(argc)},
+      mHelp,
+      mUsage,
+      outputStream,
+      errorStream);
+  }
+
+  // As `magic_args::parse()` with a `std::pmr::memory_resource*`
+  std::expected<T, incomplete_parse_reason> parse(
+    std::pmr::memory_resource* resource,
+    argument_view args,
+    FILE* outputStream = stdout,
+    FILE* errorStream = stderr) const {
+    return detail::parse<T, Traits>(
+      args, nullptr, resource, mHelp, mUsage, outputStream, errorStream);
+  }
+
+  std::expected<T, incomplete_parse_reason> parse(
+    std::pmr::memory_resource* resource,
+    int argc,
+    const char* const* argv,
+    FILE* outputStream = stdout,
+    FILE* errorStream = stderr) const {
+    return parse(
+      resource,
+      std::span {argv, static_cast<std::size_t>(argc)},
+      outputStream,
+      errorStream);
+  }
+
+  // As `magic_args::parse_into()`, reusing the storage in `out`; `T` must be
+  // copy-assignable
+  std::expected<void, incomplete_parse_reason> parse_into(
+    T& out,
+    argument_view args,
+    FILE* outputStream = stdout,
+    FILE* errorStream = stderr) const
+    requires std::is_copy_assignable_v<T>
+  {
+    detail::reset_to_default(out);
+    return detail::parse_into<T, Traits>(
+      out, args, nullptr, nullptr, mHelp, mUsage, outputStream, errorStream);
+  }
+
+  std::expected<void, incomplete_parse_reason> parse_into(
+    T& out,
+    int argc,
+    const char* const* argv,
+    FILE* outputStream = stdout,
+    FILE* errorStream = stderr) const
+    requires std::is_copy_assignable_v<T>
+  {
+    return parse_into(
+      out,
+      std::span {argv, static_cast<std::size_t>(argc)},
+      outputStream,
+      errorStream);
+  }
+
+  // As `magic_args::parse_into()` with a `std::pmr::memory_resource*`
+  std::expected<void, incomplete_parse_reason> parse_into(
+    std::pmr::memory_resource* resource,
+    T& out,
+    argument_view args,
+    FILE* outputStream = stdout,
+    FILE* errorStream = stderr) const
+    requires std::is_copy_assignable_v<T>
+  {
+    detail::reset_to_default(out);
+    return detail::parse_into<T, Traits>(
+      out, args, nullptr, resource, mHelp, mUsage, outputStream, errorStream);
+  }
+
+  std::expected<void, incomplete_parse_reason> parse_into(
+    std::pmr::memory_resource* resource,
+    T& out,
+    int argc,
+    const char* const* argv,
+    FILE* outputStream = stdout,
+    FILE* errorStream = stderr) const
+    requires std::is_copy_assignable_v<T>
+  {
+    return parse_into(
+      resource,
+      out,
+      std::span {argv, static_cast<std::size_t>(argc)},
+      outputStream,
+      errorStream);
+  }
+
+  [[nodiscard]]
+  const program_info& help() const noexcept {
+    return mHelp;
+  }
+
+ private:
+  program_info mHelp;
+  // From `format_usage()`
+  std::string mUsage;
+};
+
+}// namespace magic_args::inline public_api
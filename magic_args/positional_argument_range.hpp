@@ -0,0 +1,185 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include "argument_view.hpp"
+#include "detail/conversions.hpp"
+#endif
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <string_view>
+
+namespace magic_args::inline public_api {
+
+// A multi-value positional argument that converts values on access, rather
+// than storing a `std::vector<T>`, e.g.:
+//
+//   optional_positional_argument<positional_argument_range<std::string>>
+//
+// Values are checked by `parse()` if their conversion can fail; otherwise,
+// no conversions happen until the range is iterated.
+//
+// The range refers to the arguments passed to `parse()`, and must not
+// outlive them; copying the range does not copy the arguments.
+template <class T>
+class positional_argument_range {
+ public:
+  static constexpr bool is_positional_argument_range = true;
+  using value_type = T;
+
+  class iterator {
+   public:
+    // Values are returned by value, so this is only an input iterator as far
+    // as pre-C++20 algorithms are concerned
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = T;
+
+    iterator() = default;
+
+    T operator*() const {
+      return convert(*mIt);
+    }
+
+    T operator[](difference_type n) const {
+      return convert(mIt[n]);
+    }
+
+    iterator& operator++() {
+      ++mIt;
+      return *this;
+    }
+
+    iterator operator++(int) {
+      auto ret = *this;
+      ++mIt;
+      return ret;
+    }
+
+    iterator& operator--() {
+      --mIt;
+      return *this;
+    }
+
+    iterator operator--(int) {
+      auto ret = *this;
+      --mIt;
+      return ret;
+    }
+
+    iterator& operator+=(difference_type n) {
+      mIt += n;
+      return *this;
+    }
+
+    iterator& operator-=(difference_type n) {
+      mIt -= n;
+      return *this;
+    }
+
+    friend iterator operator+(iterator it, difference_type n) {
+      return it += n;
+    }
+
+    friend iterator operator+(difference_type n, iterator it) {
+      return it += n;
+    }
+
+    friend iterator operator-(iterator it, difference_type n) {
+      return it -= n;
+    }
+
+    friend difference_type operator-(const iterator& a, const iterator& b) {
+      return a.mIt - b.mIt;
+    }
+
+    bool operator==(const iterator&) const = default;
+    auto operator<=>(const iterator&) const = default;
+
+   private:
+    friend class positional_argument_range;
+    using raw_iterator = argument_view::iterator;
+    raw_iterator mIt {};
+
+    explicit iterator(raw_iterator it) : mIt(it) {
+    }
+  };
+
+  positional_argument_range() = default;
+
+  // `owner` keeps the storage that `args` refers to alive, if it is not owned
+  // by the caller of `parse()`
+  explicit positional_argument_range(
+    argument_view args,
+    std::shared_ptr<const void> owner = {})
+    : mArgs(args), mOwner(std::move(owner)) {
+  }
+
+  [[nodiscard]]
+  iterator begin() const noexcept {
+    return iterator {mArgs.begin()};
+  }
+
+  [[nodiscard]]
+  iterator end() const noexcept {
+    return iterator {mArgs.end()};
+  }
+
+  [[nodiscard]]
+  std::size_t size() const noexcept {
+    return mArgs.size();
+  }
+
+  [[nodiscard]]
+  bool empty() const noexcept {
+    return mArgs.empty();
+  }
+
+  T operator[](std::size_t index) const {
+    return convert(mArgs[index]);
+  }
+
+  // The unconverted arguments
+  [[nodiscard]]
+  argument_view raw() const noexcept {
+    return mArgs;
+  }
+
+  bool operator==(const positional_argument_range& other) const noexcept {
+    return std::ranges::equal(mArgs, other.mArgs);
+  }
+
+ private:
+  argument_view mArgs;
+  std::shared_ptr<const void> mOwner;
+
+  static T convert(std::string_view arg) {
+    if constexpr (std::same_as<T, std::string_view>) {
+      return arg;
+    } else {
+      T ret {};
+      // Fallible conversions were checked by `parse()`
+      (void)detail::from_string_arg_outer(ret, arg);
+      return ret;
+    }
+  }
+};
+
+}// namespace magic_args::inline public_api
+
+namespace magic_args::detail {
+
+// Conversions that are checked by `parse()`, rather than just on access
+template <class T>
+concept fallible_conversion
+  = !std::same_as<T, std::string_view> && !string_conversion<T>;
+
+}// namespace magic_args::detail
@@ -19,13 +19,20 @@ struct powershell_style_parsing_traits {
   static constexpr char short_help_arg[] = "?";
   static constexpr char version_arg[] = "Version";
 
-  inline static void normalize_option_name(std::string& name);
-  static void normalize_positional_argument_name(std::string& name) {
+  // Accept unambiguous prefixes of long names, e.g. `--verb` for `--verbose`;
+  // see `unambiguous_prefixes<>`
+  static constexpr bool allow_unambiguous_prefixes = false;
+
+  // Reject arguments that are not valid UTF-8; see `strict_utf8<>`
+  static constexpr bool validate_utf8 = false;
+
+  static constexpr void normalize_option_name(std::string& name);
+  static constexpr void normalize_positional_argument_name(std::string& name) {
     return gnu_style_parsing_traits::normalize_positional_argument_name(name);
   }
 };
 
-inline void powershell_style_parsing_traits::normalize_option_name(
+constexpr void powershell_style_parsing_traits::normalize_option_name(
   std::string& name) {
   if (name.starts_with('m')) {
     if (name.size() > 1 && name[1] >= 'A' && name[1] <= 'Z') {
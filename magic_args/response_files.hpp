@@ -0,0 +1,486 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#ifdef __CLION_IDE__
+#define MAGIC_ARGS_ENABLE_RESPONSE_FILES
+#endif
+
+#if (defined(MAGIC_ARGS_ENABLE_RESPONSE_FILES) \
+     || !defined(MAGIC_ARGS_SINGLE_FILE)) \
+  && !defined(MAGIC_ARGS_RESPONSE_FILES_HPP)
+#define MAGIC_ARGS_RESPONSE_FILES_HPP
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <deque>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include "argument_view.hpp"
+#include "detail/print.hpp"
+#include "detail/usage.hpp"
+#include "gnu_style_parsing_traits.hpp"
+#include "incomplete_parse_reason.hpp"
+#endif
+
+namespace magic_args::inline public_api {
+
+enum class response_file_syntax {
+  // Whitespace-separated; single quotes, double quotes, and backslash escapes
+  // work like a POSIX shell, as in GCC and Clang
+  GNU,
+  // Quotes and backslashes are handled like the Microsoft C runtime's
+  // command line parsing, as in MSVC
+  MSVC,
+};
+
+}// namespace magic_args::inline public_api
+
+namespace magic_args::detail {
+
+struct file_id {
+  std::uint64_t mDevice {};
+  std::uint64_t mFile {};
+
+  bool operator==(const file_id&) const noexcept = default;
+};
+
+// A read-only mapping of an entire file.
+//
+// The contents are never copied; they remain valid for the lifetime of the
+// `mapped_file`, even if it is moved.
+class mapped_file {
+ public:
+  mapped_file() = delete;
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  mapped_file(mapped_file&& other) noexcept
+    : mData(std::exchange(other.mData, nullptr)),
+      mSize(std::exchange(other.mSize, 0)),
+      mID(other.mID) {
+  }
+
+  mapped_file& operator=(mapped_file&& other) noexcept {
+    if (this != &other) {
+      unmap();
+      mData = std::exchange(other.mData, nullptr);
+      mSize = std::exchange(other.mSize, 0);
+      mID = other.mID;
+    }
+    return *this;
+  }
+
+  ~mapped_file() {
+    unmap();
+  }
+
+  // `path` is UTF-8
+  [[nodiscard]]
+  static std::optional<mapped_file> open(const std::string& path);
+
+  [[nodiscard]]
+  std::string_view view() const noexcept {
+    return {mData, mSize};
+  }
+
+  [[nodiscard]]
+  file_id id() const noexcept {
+    return mID;
+  }
+
+ private:
+  const char* mData {nullptr};
+  std::size_t mSize {0};
+  file_id mID;
+
+  mapped_file(const char* data, std::size_t size, file_id id)
+    : mData(data), mSize(size), mID(id) {
+  }
+
+  void unmap() noexcept;
+};
+
+#ifdef _WIN32
+inline std::optional<mapped_file> mapped_file::open(const std::string& path) {
+  const auto wideCount = MultiByteToWideChar(
+    CP_UTF8, MB_ERR_INVALID_CHARS, path.c_str(), -1, nullptr, 0);
+  if (wideCount <= 0) {
+    return std::nullopt;
+  }
+  std::wstring widePath;
+  widePath.resize(wideCount);
+  MultiByteToWideChar(
+    CP_UTF8,
+    MB_ERR_INVALID_CHARS,
+    path.c_str(),
+    -1,
+    widePath.data(),
+    wideCount);
+
+  const auto file = CreateFileW(
+    widePath.c_str(),
+    GENERIC_READ,
+    FILE_SHARE_READ,
+    nullptr,
+    OPEN_EXISTING,
+    FILE_ATTRIBUTE_NORMAL,
+    nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return std::nullopt;
+  }
+  const struct close_t {
+    HANDLE mHandle;
+    ~close_t() {
+      CloseHandle(mHandle);
+    }
+  } closeFile {file};
+
+  BY_HANDLE_FILE_INFORMATION info {};
+  if (!GetFileInformationByHandle(file, &info)) {
+    return std::nullopt;
+  }
+  const file_id id {
+    info.dwVolumeSerialNumber,
+    (static_cast<std::uint64_t>(info.nFileIndexHigh) << 32)
+      | info.nFileIndexLow,
+  };
+  const auto size = (static_cast<std::uint64_t>(info.nFileSizeHigh) << 32)
+    | info.nFileSizeLow;
+  if (size == 0) {
+    // Empty files can't be mapped
+    return mapped_file {nullptr, 0, id};
+  }
+
+  const auto mapping
+    = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping) {
+    return std::nullopt;
+  }
+  const close_t closeMapping {mapping};
+  const auto data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data) {
+    return std::nullopt;
+  }
+  return mapped_file {
+    static_cast<const char*>(data), static_cast<std::size_t>(size), id};
+}
+
+inline void mapped_file::unmap() noexcept {
+  if (mData) {
+    UnmapViewOfFile(mData);
+    mData = nullptr;
+  }
+}
+#else
+inline std::optional<mapped_file> mapped_file::open(const std::string& path) {
+  const auto fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1) {
+    return std::nullopt;
+  }
+  const struct close_t {
+    int mFD;
+    ~close_t() {
+      ::close(mFD);
+    }
+  } closeFile {fd};
+
+  struct stat info {};
+  if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+    return std::nullopt;
+  }
+  const file_id id {
+    static_cast<std::uint64_t>(info.st_dev),
+    static_cast<std::uint64_t>(info.st_ino),
+  };
+  const auto size = static_cast<std::size_t>(info.st_size);
+  if (size == 0) {
+    // Empty files can't be mapped
+    return mapped_file {nullptr, 0, id};
+  }
+
+  const auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (data == MAP_FAILED) {
+    return std::nullopt;
+  }
+  return mapped_file {static_cast<const char*>(data), size, id};
+}
+
+inline void mapped_file::unmap() noexcept {
+  if (mData) {
+    munmap(const_cast<char*>(mData), mSize);
+    mData = nullptr;
+  }
+}
+#endif
+
+struct response_file_arguments {
+  std::vector<std::string_view> mArgs;
+  // Arguments that needed unescaping; a deque so that they never move
+  std::deque<std::string> mUnescaped;
+  std::vector<mapped_file> mFiles;
+  // Keeps the original arguments alive
+  std::shared_ptr<const void> mArgsOwner;
+};
+
+constexpr bool is_response_file_space(char c) noexcept {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v'
+    || c == '\f';
+}
+
+// Splits `text` as GCC does; arguments without quotes or backslashes refer
+// directly to `text`.
+inline void split_gnu_response_file(
+  std::string_view text,
+  std::deque<std::string>& unescaped,
+  std::vector<std::string_view>& out) {
+  std::size_t i = 0;
+  while (true) {
+    while (i < text.size() && is_response_file_space(text[i])) {
+      ++i;
+    }
+    if (i == text.size()) {
+      return;
+    }
+
+    const auto begin = i;
+    while (i < text.size() && !is_response_file_space(text[i])
+           && text[i] != '\'' && text[i] != '"' && text[i] != '\\') {
+      ++i;
+    }
+    if (i == text.size() || is_response_file_space(text[i])) {
+      out.push_back(text.substr(begin, i - begin));
+      continue;
+    }
+
+    auto& arg = unescaped.emplace_back(text.substr(begin, i - begin));
+    char quote {};
+    for (; i < text.size(); ++i) {
+      const auto c = text[i];
+      if (c == '\\' && i + 1 < text.size()) {
+        arg += text[++i];
+        continue;
+      }
+      if (quote) {
+        if (c == quote) {
+          quote = {};
+        } else {
+          arg += c;
+        }
+        continue;
+      }
+      if (is_response_file_space(c)) {
+        break;
+      }
+      if (c == '\'' || c == '"') {
+        quote = c;
+        continue;
+      }
+      arg += c;
+    }
+    out.push_back(arg);
+  }
+}
+
+// Splits `text` like the Microsoft C runtime splits everything after the
+// program name; unlike `CommandLineToArgvW()`, `""` in a quoted section is a
+// literal quote that does not end the section.
+//
+// Arguments without double quotes refer directly to `text`.
+inline void split_msvc_response_file(
+  std::string_view text,
+  std::deque<std::string>& unescaped,
+  std::vector<std::string_view>& out) {
+  std::size_t i = 0;
+  while (true) {
+    while (i < text.size() && is_response_file_space(text[i])) {
+      ++i;
+    }
+    if (i == text.size()) {
+      return;
+    }
+
+    // Backslashes are only special before a double quote
+    const auto begin = i;
+    while (i < text.size() && !is_response_file_space(text[i])
+           && text[i] != '"') {
+      ++i;
+    }
+    if (i == text.size() || is_response_file_space(text[i])) {
+      out.push_back(text.substr(begin, i - begin));
+      continue;
+    }
+
+    auto& arg = unescaped.emplace_back();
+    bool quoted = false;
+    for (i = begin; i < text.size();) {
+      const auto c = text[i];
+      if (c == '\\') {
+        const auto last = text.find_first_not_of('\\', i);
+        const auto count = std::min(last, text.size()) - i;
+        i += count;
+        if (i < text.size() && text[i] == '"') {
+          // 2n backslashes + `"`: n backslashes, then a quote toggle
+          // 2n + 1 backslashes + `"`: n backslashes, then a literal `"`
+          arg.append(count / 2, '\\');
+          if (count % 2) {
+            arg += '"';
+            ++i;
+          }
+        } else {
+          arg.append(count, '\\');
+        }
+        continue;
+      }
+      if (c == '"') {
+        if (quoted && i + 1 < text.size() && text[i + 1] == '"') {
+          arg += '"';
+          i += 2;
+          continue;
+        }
+        quoted = !quoted;
+        ++i;
+        continue;
+      }
+      if (is_response_file_space(c) && !quoted) {
+        break;
+      }
+      arg += c;
+      ++i;
+    }
+    out.push_back(arg);
+  }
+}
+
+template <class Traits>
+std::expected<void, incomplete_parse_reason> expand_response_file(
+  std::string_view path,
+  response_file_arguments& out,
+  std::vector<file_id>& includeStack,
+  std::string_view argv0,
+  FILE* errorStream) {
+  auto file = mapped_file::open(std::string {path});
+  if (!file) {
+    detail::println(
+      errorStream,
+      "{}: Failed to read response file `{}`",
+      program_name(argv0),
+      path);
+    return std::unexpected {incomplete_parse_reason::InvalidResponseFile};
+  }
+  const auto id = file->id();
+  if (std::ranges::find(includeStack, id) != includeStack.end()) {
+    detail::println(
+      errorStream,
+      "{}: Response file `{}` includes itself",
+      program_name(argv0),
+      path);
+    return std::unexpected {incomplete_parse_reason::InvalidResponseFile};
+  }
+
+  const auto text = file->view();
+  out.mFiles.push_back(std::move(*file));
+
+  std::vector<std::string_view> args;
+  if constexpr (Traits::response_file_quoting == response_file_syntax::MSVC) {
+    split_msvc_response_file(text, out.mUnescaped, args);
+  } else {
+    split_gnu_response_file(text, out.mUnescaped, args);
+  }
+
+  includeStack.push_back(id);
+  for (auto&& arg: args) {
+    if (Traits::nested_response_files && arg.starts_with('@')) {
+      const auto expanded = expand_response_file<Traits>(
+        arg.substr(1), out, includeStack, argv0, errorStream);
+      if (!expanded) {
+        return expanded;
+      }
+      continue;
+    }
+    out.mArgs.push_back(arg);
+  }
+  includeStack.pop_back();
+  return {};
+}
+
+// If there are no response files, `args` is returned unmodified, and nothing
+// is allocated. Otherwise, the returned arguments are kept alive by `owner`,
+// which replaces - and keeps alive - the previous owner of `args`.
+template <class Traits>
+std::expected<argument_view, incomplete_parse_reason>
+expand_response_files(
+  std::shared_ptr<const void>& owner,
+  argument_view args,
+  FILE* errorStream) {
+  const auto isResponseFile
+    = [](std::string_view arg) { return arg.starts_with('@'); };
+  if (args.empty() || std::ranges::none_of(args.subspan(1), isResponseFile)) {
+    return args;
+  }
+
+  const auto storage = std::make_shared<response_file_arguments>();
+  storage->mArgsOwner = std::move(owner);
+  owner = storage;
+  auto& out = *storage;
+  out.mArgs.reserve(args.size());
+  out.mArgs.push_back(args.front());
+  std::vector<file_id> includeStack;
+  for (auto&& arg: args.subspan(1)) {
+    if (!isResponseFile(arg)) {
+      out.mArgs.push_back(arg);
+      continue;
+    }
+    const auto expanded = expand_response_file<Traits>(
+      arg.substr(1), out, includeStack, args.front(), errorStream);
+    if (!expanded) {
+      return std::unexpected {expanded.error()};
+    }
+  }
+  return argument_view {out.mArgs};
+}
+
+}// namespace magic_args::detail
+
+namespace magic_args::inline public_api {
+
+// Replaces `@path` arguments with the contents of the file at `path`.
+//
+// If `AllowNesting` is true, `@path` arguments in response files are also
+// expanded.
+template <
+  class T,
+  response_file_syntax Syntax = response_file_syntax::GNU,
+  bool AllowNesting = true>
+struct response_files : T {
+  static constexpr auto response_file_quoting = Syntax;
+  static constexpr bool nested_response_files = AllowNesting;
+
+  static auto expand_response_files(
+    std::shared_ptr<const void>& owner,
+    argument_view args,
+    FILE* errorStream) {
+    return detail::expand_response_files<response_files>(
+      owner, args, errorStream);
+  }
+};
+
+}// namespace magic_args::inline public_api
+
+#endif
@@ -0,0 +1,18 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include "gnu_style_parsing_traits.hpp"
+#endif
+
+namespace magic_args::inline public_api {
+
+// Fail with `incomplete_parse_reason::InvalidEncoding` if any argument after
+// the program name is not valid UTF-8
+template <class T>
+struct strict_utf8 : T {
+  static constexpr bool validate_utf8 = true;
+};
+
+}// namespace magic_args::inline public_api
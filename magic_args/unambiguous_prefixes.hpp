@@ -0,0 +1,16 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#ifndef MAGIC_ARGS_SINGLE_FILE
+#include "gnu_style_parsing_traits.hpp"
+#endif
+
+namespace magic_args::inline public_api {
+
+template <class T>
+struct unambiguous_prefixes : T {
+  static constexpr bool allow_unambiguous_prefixes = true;
+};
+
+}// namespace magic_args::inline public_api
@@ -10,8 +10,8 @@ namespace magic_args::inline public_api {
 
 template <class T>
 struct verbatim_names : T {
-  static void normalize_option_name(std::string&) {};
-  static void normalize_positional_argument_name(std::string&) {};
+  static constexpr void normalize_option_name(std::string&) {};
+  static constexpr void normalize_positional_argument_name(std::string&) {};
 };
 
 }// namespace magic_args::inline public_api
\ No newline at end of file
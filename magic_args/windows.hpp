@@ -10,78 +10,80 @@
 
 #include <Windows.h>
 
+#include <memory>
 #include <string>
 
 #ifndef MAGIC_ARGS_SINGLE_FILE
+#include "command_line.hpp"
+#include "detail/unicode.hpp"
 #include "parse.hpp"
 #endif
 
 namespace magic_args::detail {
-inline std::expected<void, incomplete_parse_reason> utf8_from_wide(
-  std::string& buffer,
-  const std::wstring_view wide) {
-  if (wide.empty()) {
-    buffer = {};
-    return {};
-  }
-  const auto byteCount = WideCharToMultiByte(
-    CP_UTF8,
-    WC_ERR_INVALID_CHARS,
-    wide.data(),
-    static_cast<INT>(wide.size()),
-    nullptr,
-    0,
-    nullptr,
-    nullptr);
-  if (byteCount <= 0) {
-    return std::unexpected {incomplete_parse_reason::InvalidEncoding};
+
+// The quoted path of the current executable, or an empty string on failure.
+//
+// `CommandLineToArgvW()` returns this path for an empty command line, but
+// `command_line_arguments` returns no arguments at all.
+inline std::wstring current_executable_command_line() {
+  std::wstring path(MAX_PATH, L'\0');
+  while (true) {
+    const auto length = GetModuleFileNameW(
+      nullptr, path.data(), static_cast<DWORD>(path.size()));
+    if (length == 0) {
+      return {};
+    }
+    if (length < path.size()) {
+      path.resize(length);
+      break;
+    }
+    // Truncated
+    path.resize(path.size() * 2);
   }
-  buffer.resize(byteCount);
-  WideCharToMultiByte(
-    CP_UTF8,
-    WC_ERR_INVALID_CHARS,
-    wide.data(),
-    static_cast<INT>(wide.size()),
-    buffer.data(),
-    static_cast<INT>(buffer.size()),
-    nullptr,
-    nullptr);
-  return {};
+  // Paths can not contain quotes
+  return L'"' + path + L'"';
 }
 
-struct local_free_deleter {
-  void operator()(auto ptr) const noexcept {
-    LocalFree(ptr);
-  }
-};
 }// namespace magic_args::detail
 
 namespace magic_args::inline public_api {
 
+// An empty `commandLine` is treated as the path of the current executable, as
+// with `CommandLineToArgvW()`
 template <class T, class Traits = gnu_style_parsing_traits>
 std::expected<T, incomplete_parse_reason> parse(
   const wchar_t* const commandLine,
   const program_info& help = {},
   FILE* outputStream = stdout,
   FILE* errorStream = stderr) {
-  int argc {};
-  std::unique_ptr<LPWSTR, detail::local_free_deleter> wargv {
-    CommandLineToArgvW(commandLine, &argc)};
-
-  std::vector<std::string> argv {};
-  argv.reserve(argc);
-
-  std::string buffer;
-  buffer.resize(512);
-  for (auto&& it: std::span {wargv.get(), static_cast<std::size_t>(argc)}) {
-    if (const auto encode = detail::utf8_from_wide(buffer, it); !encode) {
-      return std::unexpected {encode.error()};
+  static_assert(
+    !detail::has_argument_views<T>(),
+    "The split command line is freed when parse() returns; use std::string "
+    "or positional_argument_range<std::string_view> instead of "
+    "std::string_view");
+  if (*commandLine == L'\0') {
+    const auto executable = detail::current_executable_command_line();
+    if (executable.empty()) {
+      detail::println(
+        errorStream, "Could not find the path of the current executable");
+      return std::unexpected {incomplete_parse_reason::InvalidArgument};
     }
-    argv.push_back(buffer);
+    return parse<T, Traits>(
+      executable.c_str(), help, outputStream, errorStream);
   }
 
-  std::vector<std::string_view> argvsv {argv.begin(), argv.end()};
-  return parse<T, Traits>(std::span {argvsv}, help, outputStream, errorStream);
+  const std::wstring_view wide {commandLine};
+  std::string utf8;
+  utf8.resize(detail::max_utf8_length<wchar_t>(wide.size()));
+  const auto written = detail::utf8_from_wide(wide, utf8.data());
+  if (!written) {
+    return std::unexpected {written.error()};
+  }
+  utf8.resize(*written);
+  // Shared with any `positional_argument_range<>` in the result
+  const auto argv = std::make_shared<const command_line_arguments>(utf8);
+  return detail::parse<T, Traits>(
+    *argv, argv, nullptr, help, {}, outputStream, errorStream);
 }
 
 template <class T, class Traits = gnu_style_parsing_traits>
@@ -90,7 +92,27 @@ std::expected<T, incomplete_parse_reason> parse(
   const program_info& help = {},
   FILE* outputStream = stdout,
   FILE* errorStream = stderr) {
-  // There's CommandLineToArgvW, but no CommandLineToArgvA
+  static_assert(
+    !detail::has_argument_views<T>(),
+    "The split command line is freed when parse() returns; use std::string "
+    "or positional_argument_range<std::string_view> instead of "
+    "std::string_view");
+  if (*commandLine == '\0') {
+    return parse<T, Traits>(L"", help, outputStream, errorStream);
+  }
+
+  // Already UTF-8, e.g. with a UTF-8 process code page manifest
+  if (GetACP() == CP_UTF8) {
+    if (!detail::is_valid_utf8(commandLine)) {
+      return std::unexpected {incomplete_parse_reason::InvalidEncoding};
+    }
+    const auto argv = std::make_shared<const command_line_arguments>(
+      std::string_view {commandLine});
+    return detail::parse<T, Traits>(
+      *argv, argv, nullptr, help, {}, outputStream, errorStream);
+  }
+
+  // There is no direct conversion from the ANSI code page to UTF-8
   const auto charCount = MultiByteToWideChar(
     CP_ACP, MB_ERR_INVALID_CHARS, commandLine, -1, nullptr, 0);
   if (charCount <= 0) {
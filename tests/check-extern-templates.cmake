@@ -0,0 +1,50 @@
+# Copyright 2025 Fred Emmott <fred@fredemmott.com>
+# SPDX-License-Identifier: MIT
+#
+# Checks that an object file references the instantiations declared by
+# `MAGIC_ARGS_DECLARE_PARSER()` and `MAGIC_ARGS_DECLARE_DUMP()`, without
+# defining them.
+#
+# Usage:
+#
+#   cmake -DNM=... -DOBJECT=... -DTYPE=... -P check-extern-templates.cmake
+foreach (VAR NM OBJECT TYPE)
+  if (NOT DEFINED ${VAR})
+    message(FATAL_ERROR "${VAR} must be defined")
+  endif ()
+endforeach ()
+
+execute_process(
+  COMMAND "${NM}" -C "${OBJECT}"
+  RESULT_VARIABLE RESULT
+  OUTPUT_VARIABLE SYMBOLS
+  ERROR_VARIABLE ERROR
+)
+if (NOT RESULT EQUAL 0)
+  message(FATAL_ERROR "`${NM} -C ${OBJECT}` failed:\n${ERROR}")
+endif ()
+
+string(REPLACE ";" "\;" SYMBOLS "${SYMBOLS}")
+string(REPLACE "\n" ";" SYMBOLS "${SYMBOLS}")
+set(PATTERN "magic_args::(public_api::|detail::)?(parse|parse_into|dump|show_usage)<${TYPE}[,>]")
+set(REFERENCED 0)
+set(DEFINED)
+foreach (LINE IN LISTS SYMBOLS)
+  if (NOT LINE MATCHES "${PATTERN}")
+    continue ()
+  endif ()
+  if (LINE MATCHES "^ *U ")
+    math(EXPR REFERENCED "${REFERENCED} + 1")
+  else ()
+    list(APPEND DEFINED "${LINE}")
+  endif ()
+endforeach ()
+
+if (DEFINED)
+  list(JOIN DEFINED "\n  " DEFINED)
+  message(FATAL_ERROR "${OBJECT} defines instantiations that should only be declared:\n  ${DEFINED}")
+endif ()
+if (REFERENCED EQUAL 0)
+  message(FATAL_ERROR "${OBJECT} does not reference any instantiations for ${TYPE}")
+endif ()
+message(STATUS "${OBJECT} references ${REFERENCED} declared instantiations for ${TYPE}, and defines none")
@@ -0,0 +1,29 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+//
+// Uses the instantiations that are only declared in extern-templates.hpp;
+// check-extern-templates.cmake checks that this object file does not define
+// them.
+#include "extern-templates.hpp"
+
+#include <memory_resource>
+
+namespace TestExternTemplates {
+
+int use_declared_instantiations(int argc, char** argv) {
+  auto args = magic_args::parse<SharedArgs>(argc, argv);
+  if (!args) {
+    return 1;
+  }
+  if (!magic_args::parse_into(*args, argc, argv)) {
+    return 1;
+  }
+  if (!magic_args::parse_into(
+        std::pmr::get_default_resource(), *args, argc, argv)) {
+    return 1;
+  }
+  magic_args::dump(*args);
+  return 0;
+}
+
+}// namespace TestExternTemplates
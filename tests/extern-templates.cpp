@@ -0,0 +1,11 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include "extern-templates.hpp"
+
+MAGIC_ARGS_DEFINE_PARSER(
+  TestExternTemplates::SharedArgs,
+  magic_args::gnu_style_parsing_traits);
+MAGIC_ARGS_DEFINE_PARSER(
+  TestExternTemplates::SharedArgs,
+  TestExternTemplates::PrefixTraits);
+MAGIC_ARGS_DEFINE_DUMP(TestExternTemplates::SharedArgs);
@@ -0,0 +1,24 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include <magic_args/magic_args.hpp>
+
+namespace TestExternTemplates {
+struct SharedArgs {
+  std::string mFoo;
+  int mBar {};
+  magic_args::flag mVerbose {.mHelp = "be noisy", .mShortName = "v"};
+};
+
+using PrefixTraits = magic_args::unambiguous_prefixes<
+  magic_args::powershell_style_parsing_traits>;
+}// namespace TestExternTemplates
+
+MAGIC_ARGS_DECLARE_PARSER(
+  TestExternTemplates::SharedArgs,
+  magic_args::gnu_style_parsing_traits);
+MAGIC_ARGS_DECLARE_PARSER(
+  TestExternTemplates::SharedArgs,
+  TestExternTemplates::PrefixTraits);
+MAGIC_ARGS_DECLARE_DUMP(TestExternTemplates::SharedArgs);
@@ -0,0 +1,311 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstdlib>
+#include <magic_args/magic_args.hpp>
+#include <memory_resource>
+#include <new>
+
+namespace {
+// Per-thread, so that test infrastructure on other threads can't interfere
+thread_local std::size_t gAllocationCount {0};
+}// namespace
+
+void* operator new(std::size_t size) {
+  ++gAllocationCount;
+  if (const auto ret = std::malloc(size ? size : 1)) {
+    return ret;
+  }
+  throw std::bad_alloc {};
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace TestAllocations {
+struct MyArgs {
+  bool mFoo {false};
+  magic_args::flag mBar {
+    .mShortName = "b",
+  };
+  std::string mString;
+  magic_args::option<std::string> mOther {
+    .mShortName = "o",
+  };
+};
+
+struct PositionalArgs {
+  bool mFoo {false};
+  magic_args::mandatory_positional_argument<
+    magic_args::positional_argument_range<std::string_view>>
+    mPaths;
+};
+
+struct PmrArgs {
+  // Long default values are allocated by `T {}`, before `parse()` can use the
+  // memory resource
+  std::pmr::string mName {"default"};
+  magic_args::option<std::pmr::string> mOutput {.mShortName = "o"};
+  int mLevel {0};
+  magic_args::mandatory_positional_argument<std::pmr::string> mCommand;
+  magic_args::optional_positional_argument<
+    std::pmr::vector<std::pmr::string>>
+    mInputs;
+};
+
+struct PmrRangeArgs {
+  bool mFoo {false};
+  magic_args::optional_positional_argument<
+    magic_args::positional_argument_range<std::string_view>>
+    mPaths;
+};
+
+struct ReusedArgs {
+  std::string mName;
+  magic_args::option<std::string> mOutput;
+  magic_args::optional_positional_argument<std::vector<std::string_view>>
+    mInputs;
+};
+
+struct ReusedStringArgs {
+  std::string mName;
+  magic_args::optional_positional_argument<std::vector<std::string>> mInputs;
+};
+}// namespace TestAllocations
+using namespace TestAllocations;
+
+TEST_CASE("parsing options does not allocate") {
+#if defined(_ITERATOR_DEBUG_LEVEL) && _ITERATOR_DEBUG_LEVEL > 0
+  // Debug iterators allocate a proxy for every container, including the
+  // std::strings in the returned struct
+  SKIP("MSVC debug iterators are enabled");
+#endif
+  // Values are short enough for the small-string optimization; the program
+  // path is not
+  std::vector<std::string_view> argv {
+    "/usr/local/libexec/magic_args/test_app_with_a_long_name",
+    "--foo",
+    "-b",
+    "--string=abc",
+    "--string",
+    "def",
+    "-o",
+    "ghi",
+    "--other=jkl",
+  };
+
+  // The first parse builds the per-type tables
+  REQUIRE(magic_args::parse<MyArgs>(argv).has_value());
+
+  const auto before = gAllocationCount;
+  const auto args = magic_args::parse<MyArgs>(argv);
+  const auto after = gAllocationCount;
+
+  REQUIRE(args.has_value());
+  CHECK(args->mFoo);
+  CHECK(args->mBar);
+  CHECK(args->mString == "def");
+  CHECK(args->mOther == "jkl");
+  CHECK(after == before);
+}
+
+TEST_CASE("parsing argc/argv does not allocate") {
+#if defined(_ITERATOR_DEBUG_LEVEL) && _ITERATOR_DEBUG_LEVEL > 0
+  SKIP("MSVC debug iterators are enabled");
+#endif
+  const char* const argv[] {
+    "/usr/local/libexec/magic_args/test_app_with_a_long_name",
+    "--foo",
+    "first/path/that/is/too/long/for/the/small/string/optimization",
+    "second/path/that/is/too/long/for/the/small/string/optimization",
+  };
+  constexpr auto argc = static_cast<int>(std::size(argv));
+
+  REQUIRE(magic_args::parse<PositionalArgs>(argc, argv).has_value());
+
+  const auto before = gAllocationCount;
+  const auto args = magic_args::parse<PositionalArgs>(argc, argv);
+  const auto after = gAllocationCount;
+
+  REQUIRE(args.has_value());
+  CHECK(args->mFoo);
+  CHECK(args->mPaths.mValue.size() == 2);
+  CHECK(args->mPaths.mValue[0].data() == argv[2]);
+  CHECK(after == before);
+}
+
+TEST_CASE("parse_into() reuses capacity") {
+#if defined(_ITERATOR_DEBUG_LEVEL) && _ITERATOR_DEBUG_LEVEL > 0
+  SKIP("MSVC debug iterators are enabled");
+#endif
+  // Longer than the small-string optimization, so the first parse allocates
+  const std::vector<std::string_view> longValues {
+    "my_test",
+    "--name=a/name/that/is/too/long/for/the/small/string/optimization",
+    "--output=an/output/that/is/too/long/for/the/small/string/optimization",
+    "foo",
+    "bar",
+    "baz",
+  };
+  const std::vector<std::string_view> shortValues {
+    "my_test",
+    "--name=abc",
+    "--output=def",
+    "foo",
+  };
+
+  ReusedArgs args;
+  REQUIRE(magic_args::parse_into(args, longValues).has_value());
+
+  auto before = gAllocationCount;
+  REQUIRE(magic_args::parse_into(args, shortValues).has_value());
+  REQUIRE(magic_args::parse_into(args, longValues).has_value());
+  CHECK(gAllocationCount == before);
+  CHECK(args.mName.starts_with("a/name/"));
+  CHECK(args.mOutput.mValue.starts_with("an/output/"));
+  CHECK(args.mInputs.mValue.size() == 3);
+
+  const magic_args::parser<ReusedArgs> parser;
+  before = gAllocationCount;
+  REQUIRE(parser.parse_into(args, shortValues).has_value());
+  CHECK(gAllocationCount == before);
+  CHECK(args.mName == "abc");
+  CHECK(args.mOutput == "def");
+  CHECK(args.mInputs.mValue == std::vector<std::string_view> {"foo"});
+}
+
+TEST_CASE("parse_into() reuses container elements") {
+#if defined(_ITERATOR_DEBUG_LEVEL) && _ITERATOR_DEBUG_LEVEL > 0
+  SKIP("MSVC debug iterators are enabled");
+#endif
+  const std::vector<std::string_view> longValues {
+    "my_test",
+    "--name=a/name/that/is/too/long/for/the/small/string/optimization",
+    "first/input/that/is/too/long/for/the/small/string/optimization",
+    "second/input/that/is/too/long/for/the/small/string/optimization",
+    "third/input/that/is/too/long/for/the/small/string/optimization",
+  };
+  const std::vector<std::string_view> fewerValues {
+    "my_test",
+    "--name=abc",
+    "other/input/that/is/too/long/for/the/small/string/optimization",
+  };
+
+  ReusedStringArgs args;
+  REQUIRE(magic_args::parse_into(args, longValues).has_value());
+
+  auto before = gAllocationCount;
+  REQUIRE(magic_args::parse_into(args, longValues).has_value());
+  CHECK(gAllocationCount == before);
+  REQUIRE(args.mInputs.mValue.size() == 3);
+  CHECK(args.mInputs.mValue[2].starts_with("third/input/"));
+
+  // Shrinking only destroys the elements that are no longer needed
+  before = gAllocationCount;
+  REQUIRE(magic_args::parse_into(args, fewerValues).has_value());
+  CHECK(gAllocationCount == before);
+  CHECK(args.mName == "abc");
+  REQUIRE(args.mInputs.mValue.size() == 1);
+  CHECK(args.mInputs.mValue[0].starts_with("other/input/"));
+}
+
+TEST_CASE("parsing with a memory resource does not use the global heap") {
+#if defined(_ITERATOR_DEBUG_LEVEL) && _ITERATOR_DEBUG_LEVEL > 0
+  SKIP("MSVC debug iterators are enabled");
+#endif
+  const std::vector<std::string_view> argv {
+    "my_test",
+    "--output=an output that is too long for the small string optimization",
+    "--level=3",
+    "a-command-that-is-too-long-for-the-small-string-optimization",
+    "first/input/that/is/too/long/for/the/small/string/optimization",
+    "second/input/that/is/too/long/for/the/small/string/optimization",
+  };
+
+  // The first parse builds the per-type tables
+  REQUIRE(magic_args::parse<PmrArgs>(argv).has_value());
+
+  std::array<std::byte, 4096> buffer {};
+  std::pmr::monotonic_buffer_resource arena {
+    buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+  const auto before = gAllocationCount;
+  const auto args = magic_args::parse<PmrArgs>(&arena, argv);
+  const auto after = gAllocationCount;
+
+  REQUIRE(args.has_value());
+  CHECK(after == before);
+  CHECK(args->mName == "default");
+  CHECK(
+    args->mOutput.mValue
+    == "an output that is too long for the small string optimization");
+  CHECK(args->mLevel == 3);
+  CHECK(args->mCommand.mValue.starts_with("a-command-"));
+  REQUIRE(args->mInputs.mValue.size() == 2);
+  CHECK(args->mInputs.mValue[1].starts_with("second/input/"));
+
+  CHECK(args->mName.get_allocator().resource() == &arena);
+  CHECK(args->mOutput.mValue.get_allocator().resource() == &arena);
+  CHECK(args->mInputs.mValue.get_allocator().resource() == &arena);
+  CHECK(args->mInputs.mValue[0].get_allocator().resource() == &arena);
+}
+
+TEST_CASE("memory resource - positional arguments mixed with options") {
+#if defined(_ITERATOR_DEBUG_LEVEL) && _ITERATOR_DEBUG_LEVEL > 0
+  SKIP("MSVC debug iterators are enabled");
+#endif
+  const char* const argv[] {"my_test", "a", "--foo", "b", "c"};
+  constexpr auto argc = static_cast<int>(std::size(argv));
+  REQUIRE(magic_args::parse<PmrRangeArgs>(argc, argv).has_value());
+
+  std::array<std::byte, 1024> buffer {};
+  std::pmr::monotonic_buffer_resource arena {
+    buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+  const magic_args::parser<PmrRangeArgs> parser;
+
+  const auto before = gAllocationCount;
+  const auto args = parser.parse(&arena, argv);
+  const auto after = gAllocationCount;
+
+  REQUIRE(args.has_value());
+  CHECK(after == before);
+  CHECK(args->mFoo);
+  const std::vector<std::string_view> paths {
+    args->mPaths.mValue.begin(), args->mPaths.mValue.end()};
+  CHECK(paths == std::vector<std::string_view> {"a", "b", "c"});
+}
+
+TEST_CASE("memory resource - parse_into() and argc/argv") {
+#if defined(_ITERATOR_DEBUG_LEVEL) && _ITERATOR_DEBUG_LEVEL > 0
+  SKIP("MSVC debug iterators are enabled");
+#endif
+  const char* const argv[] {"my_test", "a", "--foo", "b", "c"};
+  constexpr auto argc = static_cast<int>(std::size(argv));
+  const magic_args::parser<PmrRangeArgs> parser;
+  PmrRangeArgs args;
+  REQUIRE(magic_args::parse_into(args, argc, argv).has_value());
+
+  std::array<std::byte, 1024> buffer {};
+  std::pmr::monotonic_buffer_resource arena {
+    buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+  const auto before = gAllocationCount;
+  REQUIRE(magic_args::parse_into(&arena, args, argc, argv).has_value());
+  REQUIRE(parser.parse_into(&arena, args, argc, argv).has_value());
+  const auto parsed = parser.parse(&arena, argc, argv);
+  const auto after = gAllocationCount;
+
+  REQUIRE(parsed.has_value());
+  CHECK(after == before);
+  CHECK(args.mFoo);
+  CHECK(parsed->mFoo);
+  const std::vector<std::string_view> paths {
+    args.mPaths.mValue.begin(), args.mPaths.mValue.end()};
+  CHECK(paths == std::vector<std::string_view> {"a", "b", "c"});
+}
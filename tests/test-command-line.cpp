@@ -0,0 +1,87 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <magic_args/magic_args.hpp>
+
+#include "output.hpp"
+
+namespace TestCommandLine {
+struct MyArgs {
+  std::string mFoo;
+  bool mBar {false};
+  magic_args::optional_positional_argument<
+    magic_args::positional_argument_range<std::string_view>>
+    mRest;
+};
+
+struct SplitTestCase {
+  std::string_view mCommandLine;
+  std::vector<std::string_view> mExpected;
+};
+
+std::vector<std::string> split(std::string_view commandLine) {
+  const magic_args::command_line_arguments args {commandLine};
+  return {args.begin(), args.end()};
+}
+}// namespace TestCommandLine
+using namespace TestCommandLine;
+
+TEST_CASE("command line splitting") {
+  // Mostly from the Microsoft documentation for `CommandLineToArgvW()` and
+  // the C runtime, plus the pre-2008 handling of `""` in quoted sections
+  const auto [commandLine, expected] = GENERATE(
+    SplitTestCase {"", {}},
+    SplitTestCase {"app", {"app"}},
+    SplitTestCase {R"(app "abc" d e)", {"app", "abc", "d", "e"}},
+    SplitTestCase {R"(app a\\b d"e f"g h)", {"app", R"(a\\b)", "de fg", "h"}},
+    SplitTestCase {R"(app a\\\"b c d)", {"app", R"(a\"b)", "c", "d"}},
+    SplitTestCase {R"(app a\\\\"b c" d e)", {"app", R"(a\\b c)", "d", "e"}},
+    SplitTestCase {R"(app a"b"" c d)", {"app", R"(ab")", "c", "d"}},
+    SplitTestCase {R"(app """a""")", {"app", R"("a")"}},
+    SplitTestCase {R"(app "" "")", {"app", "", ""}},
+    SplitTestCase {"app \t a \t b \t ", {"app", "a", "b"}},
+    SplitTestCase {R"(app "unterminated quote)", {"app", "unterminated quote"}},
+    SplitTestCase {
+      R"("C:\Program Files\app.exe" x)", {R"(C:\Program Files\app.exe)", "x"}},
+    SplitTestCase {R"(C:\a\b.exe\" x)", {R"(C:\a\b.exe\")", "x"}},
+    SplitTestCase {R"("C:\app"x y)", {R"(C:\app)", "x", "y"}},
+    SplitTestCase {" app x", {"", "app", "x"}});
+  CAPTURE(commandLine);
+  CHECK(
+    split(commandLine)
+    == std::vector<std::string> {expected.begin(), expected.end()});
+}
+
+TEST_CASE("command line arguments share one buffer") {
+  magic_args::command_line_arguments args {
+    R"(app --first "second arg" third\"quoted)"};
+  REQUIRE(args.size() == 4);
+  CHECK(args[2] == "second arg");
+  CHECK(args[3] == R"(third"quoted)");
+  for (std::size_t i = 1; i < args.size(); ++i) {
+    CHECK(args[i].data() == args[i - 1].data() + args[i - 1].size());
+  }
+
+  // Moving does not invalidate the views
+  const auto first = args[1].data();
+  const auto moved = std::move(args);
+  CHECK(moved[1].data() == first);
+}
+
+TEST_CASE("parsing a command line") {
+  const magic_args::command_line_arguments commandLine {
+    R"("C:\Program Files\my_test.exe" --foo "a b" x --bar "y z")"};
+
+  Output out, err;
+  const auto args = magic_args::parse<MyArgs>(commandLine, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mFoo == "a b");
+  CHECK(args->mBar);
+  const auto& rest = args->mRest.mValue;
+  CHECK(
+    std::vector<std::string_view> {rest.begin(), rest.end()}
+    == std::vector<std::string_view> {"x", "y z"});
+}
@@ -0,0 +1,58 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "extern-templates.hpp"
+#include "output.hpp"
+
+using namespace TestExternTemplates;
+
+// These are only declared here; the instantiations are in
+// extern-templates.cpp, so these also test that linking works
+TEST_CASE("extern templates - argv") {
+  const char* const argv[] {"my_test", "--foo", "abc", "--bar=123", "-v"};
+  Output out, err;
+  const auto args = magic_args::parse<SharedArgs>(
+    static_cast<int>(std::size(argv)), argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mFoo == "abc");
+  CHECK(args->mBar == 123);
+  CHECK(args->mVerbose);
+
+  Output dumped;
+  magic_args::dump(*args, dumped);
+  CHECK_THAT(dumped.get(), Catch::Matchers::ContainsSubstring("`abc`"));
+}
+
+TEST_CASE("extern templates - usage") {
+  const std::vector<std::string_view> argv {"my_test", "--help"};
+  Output out, err;
+  const auto args = magic_args::parse<SharedArgs>(argv, {}, out, err);
+  CHECK(args.error() == magic_args::HelpRequested);
+  CHECK_THAT(out.get(), Catch::Matchers::StartsWith("Usage: my_test"));
+}
+
+TEST_CASE("extern templates - traits with template arguments") {
+  const wchar_t* const argv[] {L"my_test", L"-Fo", L"abc"};
+  Output out, err;
+  const auto args = magic_args::parse<SharedArgs, PrefixTraits>(
+    static_cast<int>(std::size(argv)), argv, {}, out, err);
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mFoo == "abc");
+}
+
+TEST_CASE("extern templates - parse_into") {
+  const char* const argv[] {"my_test", "--foo", "abc", "--bar=123"};
+  SharedArgs args;
+  Output out, err;
+  REQUIRE(magic_args::parse_into(
+            args, static_cast<int>(std::size(argv)), argv, {}, out, err)
+            .has_value());
+  CHECK(args.mFoo == "abc");
+  CHECK(args.mBar == 123);
+  CHECK_FALSE(args.mVerbose);
+}
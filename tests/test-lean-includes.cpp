@@ -0,0 +1,89 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+//
+// This is built as its own executable, as defining
+// `MAGIC_ARGS_DISABLE_STREAM_CONVERSIONS` in only some translation units of a
+// program would give the same inline templates different definitions.
+#define MAGIC_ARGS_DISABLE_STREAM_CONVERSIONS
+#include <magic_args/magic_args.hpp>
+
+// Before anything else is included, e.g. Catch2
+#if defined(_GLIBCXX_SSTREAM) || defined(_LIBCPP_SSTREAM) || defined(_SSTREAM_)
+#error "<magic_args/magic_args.hpp> includes <sstream>"
+#endif
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "output.hpp"
+
+namespace TestLeanIncludes {
+// Only convertible via `operator>>`
+struct StreamOnly {
+  int mValue {};
+};
+template <class TStream>
+TStream& operator>>(TStream& stream, StreamOnly& v) {
+  return stream >> v.mValue;
+}
+
+struct LeanArgs {
+  std::string mName;
+  int mCount {};
+  magic_args::optional_positional_argument<std::vector<std::string>> mFiles;
+};
+}// namespace TestLeanIncludes
+using namespace TestLeanIncludes;
+
+template <class T>
+constexpr bool convertible = requires(T& v, std::string_view arg) {
+  magic_args::detail::from_string_arg_outer(v, arg);
+};
+
+static_assert(convertible<int>);
+static_assert(convertible<std::string>);
+static_assert(!convertible<StreamOnly>);
+
+using magic_args::detail::program_name;
+
+static_assert(program_name("my_test") == "my_test");
+static_assert(program_name("/usr/bin/my_test") == "my_test");
+static_assert(program_name("my_test.exe") == "my_test");
+static_assert(program_name("./my.test.exe") == "my.test");
+static_assert(program_name("/home/.hidden") == ".hidden");
+static_assert(program_name("..") == "..");
+static_assert(program_name("/usr/bin/").empty());
+#ifdef _WIN32
+static_assert(program_name("C:\\foo\\bar.exe") == "bar");
+static_assert(program_name("C:bar.exe") == "bar");
+#endif
+
+TEST_CASE("lean includes - parse") {
+  const char* const argv[] {
+    "/usr/bin/my_test.exe",
+    "--name=abc",
+    "--count",
+    "123",
+    "file",
+  };
+  Output out, err;
+  const auto args = magic_args::parse<LeanArgs>(
+    static_cast<int>(std::size(argv)), argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mName == "abc");
+  CHECK(args->mCount == 123);
+  CHECK(args->mFiles == std::vector<std::string> {"file"});
+}
+
+TEST_CASE("lean includes - program name in messages") {
+  const char* const argv[] {"/usr/bin/my_test.exe", "--count=abc"};
+  Output out, err;
+  const auto args = magic_args::parse<LeanArgs>(
+    static_cast<int>(std::size(argv)), argv, {}, out, err);
+  CHECK(out.empty());
+  REQUIRE_FALSE(args.has_value());
+  CHECK(args.error() == magic_args::InvalidArgumentValue);
+  CHECK(err.get().starts_with(
+    "my_test: Invalid value for `--count`: `abc`\n\nUsage: my_test "));
+}
@@ -0,0 +1,180 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include <magic_args/magic_args.hpp>
+
+#include "output.hpp"
+
+namespace TestManyMembers {
+// Odd options are strings, even options are integers
+struct ManyArgs {
+  std::string mOption1;
+  int mOption2 {};
+  std::string mOption3;
+  int mOption4 {};
+  std::string mOption5;
+  int mOption6 {};
+  std::string mOption7;
+  int mOption8 {};
+  std::string mOption9;
+  int mOption10 {};
+  std::string mOption11;
+  int mOption12 {};
+  std::string mOption13;
+  int mOption14 {};
+  std::string mOption15;
+  int mOption16 {};
+  std::string mOption17;
+  int mOption18 {};
+  std::string mOption19;
+  int mOption20 {};
+  std::string mOption21;
+  int mOption22 {};
+  std::string mOption23;
+  int mOption24 {};
+  std::string mOption25;
+  int mOption26 {};
+  std::string mOption27;
+  int mOption28 {};
+  std::string mOption29;
+  int mOption30 {};
+  std::string mOption31;
+  int mOption32 {};
+  std::string mOption33;
+  int mOption34 {};
+  std::string mOption35;
+  int mOption36 {};
+  std::string mOption37;
+  int mOption38 {};
+  std::string mOption39;
+  int mOption40 {};
+  std::string mOption41;
+  int mOption42 {};
+  std::string mOption43;
+  int mOption44 {};
+  std::string mOption45;
+  int mOption46 {};
+  std::string mOption47;
+  int mOption48 {};
+  std::string mOption49;
+  int mOption50 {};
+  std::string mOption51;
+  int mOption52 {};
+  std::string mOption53;
+  int mOption54 {};
+  std::string mOption55;
+  int mOption56 {};
+  std::string mOption57;
+  int mOption58 {};
+  std::string mOption59;
+  int mOption60 {};
+  std::string mOption61;
+  int mOption62 {};
+  std::string mOption63;
+  int mOption64 {};
+  std::string mOption65;
+  int mOption66 {};
+  std::string mOption67;
+  int mOption68 {};
+  std::string mOption69;
+  int mOption70 {};
+  std::string mOption71;
+  int mOption72 {};
+  std::string mOption73;
+  int mOption74 {};
+  std::string mOption75;
+  int mOption76 {};
+  std::string mOption77;
+  int mOption78 {};
+  std::string mOption79;
+  int mOption80 {};
+  std::string mOption81;
+  int mOption82 {};
+  std::string mOption83;
+  int mOption84 {};
+  std::string mOption85;
+  int mOption86 {};
+  std::string mOption87;
+  int mOption88 {};
+  std::string mOption89;
+  int mOption90 {};
+  std::string mOption91;
+  int mOption92 {};
+  std::string mOption93;
+  int mOption94 {};
+  std::string mOption95;
+  int mOption96 {};
+  std::string mOption97;
+  int mOption98 {};
+  std::string mOption99;
+  int mOption100 {};
+  std::string mOption101;
+  int mOption102 {};
+  std::string mOption103;
+  int mOption104 {};
+  std::string mOption105;
+  int mOption106 {};
+  std::string mOption107;
+  int mOption108 {};
+  std::string mOption109;
+  int mOption110 {};
+  std::string mOption111;
+  int mOption112 {};
+  std::string mOption113;
+  int mOption114 {};
+  std::string mOption115;
+  int mOption116 {};
+  std::string mOption117;
+  int mOption118 {};
+  std::string mOption119;
+  int mOption120 {};
+  std::string mOption121;
+  int mOption122 {};
+  std::string mOption123;
+  int mOption124 {};
+  std::string mOption125;
+  int mOption126 {};
+  std::string mOption127;
+  int mOption128 {};
+};
+
+struct OneMore {
+  ManyArgs mArgs;
+  bool mFlag {false};
+};
+}// namespace TestManyMembers
+using namespace TestManyMembers;
+
+static_assert(magic_args::detail::count_members<ManyArgs>() == 128);
+static_assert(magic_args::detail::count_members<OneMore>() == 2);
+
+TEST_CASE("128 members") {
+  std::vector<std::string> argv {"my_test"};
+  for (int i = 1; i <= 128; ++i) {
+    argv.push_back(std::format("--option{}={}", i, i));
+  }
+
+  Output out, err;
+  const auto args = magic_args::parse<ManyArgs>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mOption1 == "1");
+  CHECK(args->mOption2 == 2);
+  CHECK(args->mOption63 == "63");
+  CHECK(args->mOption64 == 64);
+  CHECK(args->mOption127 == "127");
+  CHECK(args->mOption128 == 128);
+}
+
+TEST_CASE("128 members - usage") {
+  const std::vector<std::string_view> argv {"my_test", "--help"};
+  Output out, err;
+  const auto args = magic_args::parse<ManyArgs>(argv, {}, out, err);
+  CHECK(args.error() == magic_args::HelpRequested);
+  CHECK(err.empty());
+  CHECK_THAT(out.get(), Catch::Matchers::ContainsSubstring("--option1=VALUE"));
+  CHECK_THAT(
+    out.get(), Catch::Matchers::ContainsSubstring("--option128=VALUE"));
+}
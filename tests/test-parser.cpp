@@ -0,0 +1,202 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <magic_args/magic_args.hpp>
+
+#include <atomic>
+#include <format>
+#include <thread>
+#include <vector>
+
+#include "output.hpp"
+
+namespace TestParser {
+struct JobArgs {
+  std::string mQueue;
+  int mPriority {};
+  magic_args::flag mDryRun {
+    .mHelp = "don't actually run the job",
+    .mShortName = "n",
+  };
+  magic_args::mandatory_positional_argument<std::string> mCommand;
+  magic_args::optional_positional_argument<std::vector<std::string>> mArgs;
+};
+
+struct DefaultedArgs {
+  std::string mName {"default name"};
+  int mCount {42};
+  magic_args::flag mVerbose;
+  magic_args::optional_positional_argument<std::vector<std::string>> mInputs {
+    .mValue = {"default input"},
+  };
+};
+}// namespace TestParser
+using namespace TestParser;
+
+namespace {
+const magic_args::program_info help {
+  .mDescription = "Run a job",
+  .mVersion = "scheduler v1.2.3",
+  .mExamples = {"my_test --queue=slow -- build --release"},
+};
+}
+
+TEST_CASE("parser - parse") {
+  const magic_args::parser<JobArgs> parser {help};
+  CHECK(parser.help().mVersion == help.mVersion);
+
+  const char* const argv[] {
+    "my_test", "--queue=slow", "-n", "build", "--", "--release"};
+  Output out, err;
+  const auto args = parser.parse(
+    static_cast<int>(std::size(argv)), argv, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mQueue == "slow");
+  CHECK(args->mPriority == 0);
+  CHECK(args->mDryRun);
+  CHECK(args->mCommand == "build");
+  CHECK(args->mArgs == std::vector<std::string> {"--release"});
+
+  // Each parse starts from a default-initialized struct
+  const std::vector<std::string_view> minimal {"my_test", "test"};
+  const auto second = parser.parse(minimal, out, err);
+  REQUIRE(second.has_value());
+  CHECK(second->mQueue.empty());
+  CHECK_FALSE(second->mDryRun);
+  CHECK(second->mCommand == "test");
+  CHECK(second->mArgs.mValue.empty());
+}
+
+TEST_CASE("parser - same output as parse()") {
+  const magic_args::parser<JobArgs> parser {help};
+  const std::vector<std::vector<std::string_view>> cases {
+    {"my_test", "--help"},
+    {"my_test", "--version"},
+    {"my_test", "--priority=high", "build"},
+    {"my_test", "--queue"},
+    {"my_test", "--unknown", "build"},
+    {"my_test"},
+  };
+  for (auto&& argv: cases) {
+    Output parserOut, parserErr, freeOut, freeErr;
+    const auto fromParser = parser.parse(argv, parserOut, parserErr);
+    const auto fromFunction
+      = magic_args::parse<JobArgs>(argv, help, freeOut, freeErr);
+    REQUIRE_FALSE(fromParser.has_value());
+    REQUIRE_FALSE(fromFunction.has_value());
+    CHECK(fromParser.error() == fromFunction.error());
+    CHECK(parserOut.get() == freeOut.get());
+    CHECK(parserErr.get() == freeErr.get());
+  }
+}
+
+TEST_CASE("parser - wide arguments") {
+  const magic_args::parser<JobArgs> parser {help};
+  const wchar_t* const argv[] {L"my_test", L"--priority=3", L"build"};
+  Output out, err;
+  const auto args = parser.parse(
+    static_cast<int>(std::size(argv)), argv, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mPriority == 3);
+  CHECK(args->mCommand == "build");
+}
+
+TEST_CASE("parser - concurrent parses") {
+  const magic_args::parser<JobArgs> parser {help};
+  constexpr std::size_t threadCount = 8;
+  constexpr std::size_t parsesPerThread = 1000;
+
+  std::atomic<std::size_t> failures {0};
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < threadCount; ++i) {
+    threads.emplace_back([&parser, &failures, i] {
+      const auto queue = std::format("--queue=queue{}", i);
+      const auto priority = std::format("--priority={}", i);
+      const std::vector<std::string_view> argv {
+        "my_test", queue, priority, "build", "a", "b"};
+      for (std::size_t j = 0; j < parsesPerThread; ++j) {
+        const auto args = parser.parse(argv);
+        if (!(args && args->mQueue == queue.substr(8)
+              && args->mPriority == static_cast<int>(i)
+              && args->mArgs.mValue.size() == 2)) {
+          ++failures;
+        }
+      }
+    });
+  }
+  for (auto&& thread: threads) {
+    thread.join();
+  }
+  CHECK(failures == 0);
+}
+
+TEST_CASE("parse_into - resets to defaults") {
+  DefaultedArgs args;
+  const std::vector<std::string_view> full {
+    "my_test", "--name=foo", "--count=1", "--verbose", "a", "b"};
+  REQUIRE(magic_args::parse_into(args, full).has_value());
+  CHECK(args.mName == "foo");
+  CHECK(args.mCount == 1);
+  CHECK(args.mVerbose);
+  CHECK(args.mInputs.mValue == std::vector<std::string> {"a", "b"});
+
+  const std::vector<std::string_view> minimal {"my_test"};
+  REQUIRE(magic_args::parse_into(args, minimal).has_value());
+  CHECK(args.mName == "default name");
+  CHECK(args.mCount == 42);
+  CHECK_FALSE(args.mVerbose);
+  CHECK(args.mInputs.mValue == std::vector<std::string> {"default input"});
+
+  Output out, err;
+  const std::vector<std::string_view> invalid {"my_test", "--count=abc"};
+  CHECK(
+    magic_args::parse_into(args, invalid, {}, out, err).error()
+    == magic_args::InvalidArgumentValue);
+  CHECK_FALSE(err.empty());
+}
+
+TEST_CASE("parse_into - replaces container elements") {
+  JobArgs args;
+  const std::vector<std::string_view> three {"my_test", "build", "a", "b", "c"};
+  REQUIRE(magic_args::parse_into(args, three).has_value());
+  CHECK(args.mArgs == std::vector<std::string> {"a", "b", "c"});
+
+  const std::vector<std::string_view> one {"my_test", "build", "x"};
+  REQUIRE(magic_args::parse_into(args, one).has_value());
+  CHECK(args.mArgs == std::vector<std::string> {"x"});
+
+  const std::vector<std::string_view> two {"my_test", "build", "y", "z"};
+  REQUIRE(magic_args::parse_into(args, two).has_value());
+  CHECK(args.mArgs == std::vector<std::string> {"y", "z"});
+
+  const std::vector<std::string_view> none {"my_test", "build"};
+  REQUIRE(magic_args::parse_into(args, none).has_value());
+  CHECK(args.mArgs.mValue.empty());
+}
+
+TEST_CASE("parser - parse_into") {
+  const magic_args::parser<JobArgs> parser {help};
+  JobArgs args;
+  const char* const argv[] {"my_test", "--queue=slow", "-n", "build", "x"};
+  REQUIRE(
+    parser.parse_into(args, static_cast<int>(std::size(argv)), argv)
+      .has_value());
+  CHECK(args.mQueue == "slow");
+  CHECK(args.mDryRun);
+  CHECK(args.mCommand == "build");
+  CHECK(args.mArgs == std::vector<std::string> {"x"});
+
+  Output out, err;
+  const std::vector<std::string_view> helpArgs {"my_test", "--help"};
+  CHECK(
+    parser.parse_into(args, helpArgs, out, err).error()
+    == magic_args::HelpRequested);
+  Output freeOut, freeErr;
+  CHECK_FALSE(
+    magic_args::parse<JobArgs>(helpArgs, help, freeOut, freeErr).has_value());
+  CHECK(out.get() == freeOut.get());
+}
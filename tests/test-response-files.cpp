@@ -0,0 +1,258 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#define MAGIC_ARGS_ENABLE_RESPONSE_FILES
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include <magic_args/magic_args.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include "output.hpp"
+
+namespace {
+
+constexpr char testName[] = "C:/Foo/Bar/my_test.exe";
+
+struct ResponseFileArgs {
+  bool mVerbose {false};
+  std::string mOutput;
+  int mLevel {0};
+  magic_args::optional_positional_argument<std::vector<std::string>> mInputs;
+};
+
+struct LazyResponseFileArgs {
+  magic_args::optional_positional_argument<
+    magic_args::positional_argument_range<std::string_view>>
+    mInputs;
+};
+
+// These would refer to the contents of the response files after they are
+// freed, so `parse()` rejects them with `response_files<>`
+struct ViewArgs {
+  std::string_view mOutput;
+};
+
+struct OptionalViewArgs {
+  magic_args::option<std::optional<std::string_view>> mOutput;
+};
+
+struct ViewInputsArgs {
+  magic_args::optional_positional_argument<std::vector<std::string_view>>
+    mInputs;
+};
+
+using magic_args::detail::has_argument_views;
+static_assert(has_argument_views<ViewArgs>());
+static_assert(has_argument_views<OptionalViewArgs>());
+static_assert(has_argument_views<ViewInputsArgs>());
+static_assert(!has_argument_views<ResponseFileArgs>());
+static_assert(!has_argument_views<LazyResponseFileArgs>());
+
+// Removed when destroyed
+class TempFile {
+ public:
+  explicit TempFile(std::string_view content) {
+    static std::size_t sCount {0};
+    mPath = std::filesystem::temp_directory_path()
+      / std::format("magic_args-test-{}-{}.rsp",
+                    reinterpret_cast<std::uintptr_t>(this),
+                    ++sCount);
+    write(content);
+  }
+
+  ~TempFile() {
+    std::filesystem::remove(mPath);
+  }
+
+  void write(std::string_view content) const {
+    std::ofstream(mPath, std::ios::binary | std::ios::trunc) << content;
+  }
+
+  std::string arg() const {
+    return "@" + mPath.string();
+  }
+
+ private:
+  std::filesystem::path mPath;
+};
+
+}// namespace
+
+TEST_CASE("response files are not expanded by default") {
+  std::vector<std::string_view> argv {testName, "@foo"};
+
+  Output out, err;
+  const auto args = magic_args::parse<ResponseFileArgs>(argv, {}, out, err);
+  REQUIRE(args.has_value());
+  CHECK(args->mInputs.mValue == std::vector<std::string> {"@foo"});
+}
+
+TEST_CASE("GNU-style response file") {
+  const TempFile file(R"(--verbose
+--output "some file.txt" --level=3
+'single quoted' with\ space "a\"b" ''
+)");
+  const auto fileArg = file.arg();
+  std::vector<std::string_view> argv {testName, "first", fileArg, "last"};
+
+  Output out, err;
+  const auto args = magic_args::parse<
+    ResponseFileArgs,
+    magic_args::response_files<magic_args::gnu_style_parsing_traits>>(
+    argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mVerbose);
+  CHECK(args->mOutput == "some file.txt");
+  CHECK(args->mLevel == 3);
+  CHECK(
+    args->mInputs.mValue
+    == std::vector<std::string> {
+      "first", "single quoted", "with space", "a\"b", "", "last"});
+}
+
+TEST_CASE("MSVC-style response file") {
+  const TempFile file(
+    R"(--output "C:\Program Files\out.txt" C:\a\b\ "x\"y" "a""b" \\\\"c d")"
+    "\r\n--verbose\r\n");
+  const auto fileArg = file.arg();
+  std::vector<std::string_view> argv {testName, fileArg};
+
+  Output out, err;
+  const auto args = magic_args::parse<
+    ResponseFileArgs,
+    magic_args::response_files<
+      magic_args::gnu_style_parsing_traits,
+      magic_args::response_file_syntax::MSVC>>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mVerbose);
+  CHECK(args->mOutput == R"(C:\Program Files\out.txt)");
+  CHECK(
+    args->mInputs.mValue
+    == std::vector<std::string> {R"(C:\a\b\)", "x\"y", "a\"b", R"(\\c d)"});
+}
+
+TEST_CASE("nested response files") {
+  const TempFile inner("--level 2 inner");
+  const TempFile outer(std::format("outer {} --verbose", inner.arg()));
+  const auto fileArg = outer.arg();
+  std::vector<std::string_view> argv {testName, fileArg};
+
+  Output out, err;
+  using Traits
+    = magic_args::response_files<magic_args::gnu_style_parsing_traits>;
+  const auto args = magic_args::parse<ResponseFileArgs, Traits>(
+    argv, {}, out, err);
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mVerbose);
+  CHECK(args->mLevel == 2);
+  CHECK(args->mInputs.mValue == std::vector<std::string> {"outer", "inner"});
+
+  using NoNesting = magic_args::response_files<
+    magic_args::gnu_style_parsing_traits,
+    magic_args::response_file_syntax::GNU,
+    /* AllowNesting = */ false>;
+  const auto unnested = magic_args::parse<ResponseFileArgs, NoNesting>(
+    argv, {}, out, err);
+  REQUIRE(unnested.has_value());
+  CHECK(unnested->mLevel == 0);
+  CHECK(
+    unnested->mInputs.mValue
+    == std::vector<std::string> {"outer", inner.arg()});
+}
+
+TEST_CASE("recursive response files") {
+  const TempFile a("a");
+  const TempFile b(std::format("b {}", a.arg()));
+  a.write(std::format("a {}", b.arg()));
+  const auto fileArg = a.arg();
+  std::vector<std::string_view> argv {testName, fileArg};
+
+  Output out, err;
+  const auto args = magic_args::parse<
+    ResponseFileArgs,
+    magic_args::response_files<magic_args::gnu_style_parsing_traits>>(
+    argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(
+    args.error() == magic_args::incomplete_parse_reason::InvalidResponseFile);
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith(
+      std::format("my_test: Response file `{}` includes itself\n\nUsage: ",
+                  a.arg().substr(1))));
+}
+
+TEST_CASE("missing response file") {
+  std::vector<std::string_view> argv {
+    testName, "@/magic_args/does/not/exist.rsp"};
+
+  Output out, err;
+  const auto args = magic_args::parse<
+    ResponseFileArgs,
+    magic_args::response_files<magic_args::gnu_style_parsing_traits>>(
+    argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(
+    args.error() == magic_args::incomplete_parse_reason::InvalidResponseFile);
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith(
+      "my_test: Failed to read response file `/magic_args/does/not/exist.rsp`"
+      "\n\nUsage: "));
+}
+
+TEST_CASE("empty response file") {
+  const TempFile file("");
+  const auto fileArg = file.arg();
+  std::vector<std::string_view> argv {testName, fileArg, "--verbose"};
+
+  Output out, err;
+  const auto args = magic_args::parse<
+    ResponseFileArgs,
+    magic_args::response_files<magic_args::gnu_style_parsing_traits>>(
+    argv, {}, out, err);
+  REQUIRE(args.has_value());
+  CHECK(args->mVerbose);
+  CHECK(args->mInputs.mValue.empty());
+}
+
+TEST_CASE("unescaped response file arguments are not copied") {
+  std::deque<std::string> unescaped;
+  std::vector<std::string_view> args;
+  const std::string_view text {"plain 'quoted' --opt=value"};
+  magic_args::detail::split_gnu_response_file(text, unescaped, args);
+  REQUIRE(args.size() == 3);
+  CHECK(unescaped.size() == 1);
+  CHECK(args[0].data() == text.data());
+  CHECK(args[1] == "quoted");
+  CHECK(args[2].data() == text.data() + text.find("--opt"));
+}
+
+TEST_CASE("positional_argument_range from response files") {
+  std::optional<LazyResponseFileArgs> args;
+  {
+    const TempFile file("a 'b c' d");
+    const auto fileArg = file.arg();
+    std::vector<std::string_view> argv {testName, fileArg};
+
+    Output out, err;
+    auto parsed = magic_args::parse<
+      LazyResponseFileArgs,
+      magic_args::response_files<magic_args::gnu_style_parsing_traits>>(
+      argv, {}, out, err);
+    REQUIRE(parsed.has_value());
+    args = std::move(*parsed);
+  }
+  // The file and `argv` are gone, but the mapping is kept alive by the range
+  const auto& inputs = args->mInputs.mValue;
+  CHECK(
+    std::vector<std::string_view> {inputs.begin(), inputs.end()}
+    == std::vector<std::string_view> {"a", "b c", "d"});
+}
@@ -86,3 +86,41 @@ TEST_CASE("args, powershell-style") {
   CHECK(args->mFlag);
   CHECK(args->mDocumentedFlag);
 }
+
+TEST_CASE("short args, powershell-style") {
+  std::vector<std::string_view> argv {
+    "test_app",
+    "-d",
+    "-String=stringValue",
+  };
+  Output out, err;
+  const auto args
+    = magic_args::parse<MyArgs, magic_args::powershell_style_parsing_traits>(
+      argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mString == "stringValue");
+  CHECK_FALSE(args->mFlag);
+  CHECK(args->mDocumentedFlag);
+}
+
+TEST_CASE("unambiguous prefixes, powershell-style") {
+  std::vector<std::string_view> argv {
+    "test_app",
+    "-Str",
+    "stringValue",
+    "-Doc",
+  };
+  Output out, err;
+  const auto args = magic_args::parse<
+    MyArgs,
+    magic_args::unambiguous_prefixes<
+      magic_args::powershell_style_parsing_traits>>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mString == "stringValue");
+  CHECK_FALSE(args->mFlag);
+  CHECK(args->mDocumentedFlag);
+}
@@ -0,0 +1,112 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include <magic_args/magic_args.hpp>
+
+#include "output.hpp"
+
+namespace TestUTF8 {
+struct MyArgs {
+  std::string mFoo;
+  magic_args::optional_positional_argument<std::vector<std::string>> mRest;
+};
+
+using StrictTraits
+  = magic_args::strict_utf8<magic_args::gnu_style_parsing_traits>;
+
+bool is_valid(std::string_view in) {
+  const auto simd = magic_args::detail::is_valid_utf8(in);
+  CHECK(simd == magic_args::detail::is_valid_utf8_scalar(in));
+  return simd;
+}
+
+constexpr char testName[] = "C:/Foo/Bar/my_test.exe";
+}// namespace TestUTF8
+using namespace TestUTF8;
+
+TEST_CASE("valid UTF-8") {
+  const std::string_view valid = GENERATE(
+    "",
+    "abc",
+    "ą",
+    "€",
+    "💩",
+    "\x7f",
+    "\xc2\x80",
+    "\xdf\xbf",
+    "\xe0\xa0\x80",
+    "\xed\x9f\xbf",
+    "\xee\x80\x80",
+    "\xf0\x90\x80\x80",
+    "\xf4\x8f\xbf\xbf");
+  // At every offset relative to the SIMD blocks, surrounded by ASCII
+  for (std::size_t prefix = 0; prefix < 70; ++prefix) {
+    const std::string ascii(prefix, 'x');
+    CAPTURE(prefix, valid);
+    CHECK(is_valid(ascii + std::string {valid}));
+    CHECK(is_valid(ascii + std::string {valid} + std::string(70, 'y')));
+  }
+}
+
+TEST_CASE("invalid UTF-8") {
+  const std::string_view invalid = GENERATE(
+    // Continuation bytes without a lead byte
+    "\x80",
+    "\xbf",
+    // Overlong encodings
+    "\xc0\xaf",
+    "\xc1\xbf",
+    "\xe0\x80\xaf",
+    "\xf0\x80\x80\xaf",
+    // Surrogates
+    "\xed\xa0\x80",
+    "\xed\xbf\xbf",
+    // Above U+10FFFF
+    "\xf4\x90\x80\x80",
+    "\xf5\x80\x80\x80",
+    "\xff",
+    // Truncated
+    "\xc3",
+    "\xe2\x82",
+    "\xf0\x9f\x92",
+    // Bad continuation bytes
+    "\xe2\x28\xa1",
+    "\xf0\x9f\x28\xa9");
+  for (std::size_t prefix = 0; prefix < 70; ++prefix) {
+    const std::string ascii(prefix, 'x');
+    CAPTURE(prefix, invalid);
+    CHECK_FALSE(is_valid(ascii + std::string {invalid}));
+    CHECK_FALSE(is_valid(ascii + std::string {invalid} + std::string(70, 'y')));
+  }
+}
+
+TEST_CASE("UTF-8 is not validated by default") {
+  std::vector<std::string_view> argv {testName, "--foo", "\xff"};
+
+  Output out, err;
+  const auto args = magic_args::parse<MyArgs>(argv, {}, out, err);
+  REQUIRE(args.has_value());
+  CHECK(args->mFoo == "\xff");
+}
+
+TEST_CASE("strict UTF-8") {
+  std::vector<std::string_view> argv {
+    testName, "--foo", "Dzień dobry", "💩", "abc"};
+
+  Output out, err;
+  auto args = magic_args::parse<MyArgs, StrictTraits>(argv, {}, out, err);
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mFoo == "Dzień dobry");
+
+  argv.push_back("a\xed\xa0\x80z");
+  args = magic_args::parse<MyArgs, StrictTraits>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(args.error() == magic_args::incomplete_parse_reason::InvalidEncoding);
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith(
+      "my_test: Argument 5 is not valid UTF-8\n\nUsage: my_test"));
+}
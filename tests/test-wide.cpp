@@ -0,0 +1,150 @@
+// Copyright 2025 Fred Emmott <fred@fredemmott.com>
+// SPDX-License-Identifier: MIT
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include <magic_args/magic_args.hpp>
+
+#include "output.hpp"
+
+namespace TestWide {
+struct MyArgs {
+  std::string mFoo;
+  std::string mBar;
+  magic_args::optional_positional_argument<
+    magic_args::positional_argument_range<std::string_view>>
+    mRest;
+};
+
+struct Piece {
+  std::u16string_view mUTF16;
+  std::string_view mUTF8;
+};
+
+// 1, 2, 3, and 4-byte UTF-8
+constexpr Piece Pieces[] {
+  {u"a", "a"},
+  {u"ą", "ą"},
+  {u"€", "€"},
+  {u"💩", "💩"},
+};
+
+std::string to_utf8(std::u16string_view in) {
+  std::string ret;
+  ret.resize(magic_args::detail::max_utf8_length<char16_t>(in.size()));
+  const auto written = magic_args::detail::utf8_from_wide(in, ret.data());
+  REQUIRE(written.has_value());
+  ret.resize(*written);
+  return ret;
+}
+
+bool is_valid(std::u16string_view in) {
+  std::string buffer;
+  buffer.resize(magic_args::detail::max_utf8_length<char16_t>(in.size()));
+  const auto simd = magic_args::detail::utf8_from_wide(in, buffer.data());
+  const auto scalar
+    = magic_args::detail::utf8_from_wide_scalar(in, buffer.data());
+  CHECK(simd.has_value() == scalar.has_value());
+  return simd.has_value();
+}
+}// namespace TestWide
+using namespace TestWide;
+
+TEST_CASE("UTF-16 to UTF-8") {
+  CHECK(to_utf8(u"").empty());
+  CHECK(to_utf8(u"abc") == "abc");
+  CHECK(to_utf8(u"Dzień dobry 💩") == "Dzień dobry 💩");
+
+  // Every piece at every offset relative to the SIMD blocks, surrounded by
+  // ASCII
+  for (std::size_t prefix = 0; prefix < 40; ++prefix) {
+    for (auto&& [utf16, utf8]: Pieces) {
+      std::u16string in(prefix, u'x');
+      std::string expected(prefix, 'x');
+      for (std::size_t i = 0; i < 3; ++i) {
+        in += utf16;
+        expected += utf8;
+      }
+      in.append(40 - prefix, u'y');
+      expected.append(40 - prefix, 'y');
+      CAPTURE(prefix, utf8);
+      CHECK(to_utf8(in) == expected);
+    }
+  }
+}
+
+TEST_CASE("invalid UTF-16") {
+  const std::u16string_view highSurrogate {u"\xd83d"};
+  const std::u16string_view lowSurrogate {u"\xdca9"};
+  for (std::size_t prefix = 0; prefix < 40; ++prefix) {
+    const std::u16string ascii(prefix, u'x');
+    CAPTURE(prefix);
+    CHECK_FALSE(is_valid(ascii + std::u16string {highSurrogate}));
+    CHECK_FALSE(is_valid(ascii + std::u16string {highSurrogate} + u"abc"));
+    CHECK_FALSE(is_valid(ascii + std::u16string {lowSurrogate} + u"abc"));
+    CHECK_FALSE(is_valid(
+      ascii + std::u16string {lowSurrogate} + std::u16string {highSurrogate}));
+    CHECK(is_valid(
+      ascii + std::u16string {highSurrogate} + std::u16string {lowSurrogate}));
+  }
+}
+
+TEST_CASE("UTF-16 arguments") {
+  const std::vector<std::u16string> argv {
+    u"my_test", u"--foo", u"Dzień dobry", u"--bar=💩", u"a", u"€"};
+
+  Output out, err;
+  const auto args = magic_args::parse<MyArgs>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mFoo == "Dzień dobry");
+  CHECK(args->mBar == "💩");
+  const auto& rest = args->mRest.mValue;
+  CHECK(
+    std::vector<std::string_view> {rest.begin(), rest.end()}
+    == std::vector<std::string_view> {"a", "€"});
+}
+
+TEST_CASE("wmain arguments") {
+  const wchar_t* const argv[] {L"my_test", L"--foo", L"Dzień dobry", L"💩"};
+
+  Output out, err;
+  const auto args = magic_args::parse<MyArgs>(
+    static_cast<int>(std::size(argv)), argv, {}, out, err);
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mFoo == "Dzień dobry");
+  REQUIRE(args->mRest.mValue.size() == 1);
+  CHECK(args->mRest.mValue[0] == "💩");
+}
+
+TEST_CASE("invalid UTF-16 arguments") {
+  const std::vector<std::u16string_view> argv {
+    u"C:/Foo/Bar/my_test.exe", u"--foo", u"abc\xd83d"};
+
+  Output out, err;
+  const auto args = magic_args::parse<MyArgs>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(args.error() == magic_args::incomplete_parse_reason::InvalidEncoding);
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith(
+      "my_test: Argument 2 is not valid UTF-16\n\nUsage: my_test"));
+}
+
+TEST_CASE("invalid UTF-32 arguments") {
+  const std::vector<std::u32string_view> argv {
+    U"my_test", U"--foo", std::u32string_view {U"\x110000"}};
+
+  Output out, err;
+  const auto args = magic_args::parse<MyArgs>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(args.error() == magic_args::incomplete_parse_reason::InvalidEncoding);
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith("my_test: Argument 2 is not valid UTF-32"));
+
+  const std::vector<std::u32string_view> invalidName {
+    std::u32string_view {U"\xd800"}};
+  CHECK_FALSE(magic_args::parse<MyArgs>(invalidName, {}, out, err));
+}
@@ -53,3 +53,19 @@ TEST_CASE("winMain", "[windows]") {
   CHECK(args->mEmpty.empty());
   CHECK(args->mBaz == "test");
 }
+
+TEST_CASE("empty command line", "[windows]") {
+  // As with `CommandLineToArgvW()`, the program name is the current executable
+  Output out, err;
+  const auto wide = magic_args::parse<MyArgs>(L"", {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(wide.has_value());
+  CHECK(wide->mFoo.empty());
+
+  const auto narrow = magic_args::parse<MyArgs>("", {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(narrow.has_value());
+  CHECK(narrow->mFoo.empty());
+}
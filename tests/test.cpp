@@ -108,6 +108,86 @@ struct MandatoryMultiValuePositionalArgument {
   magic_args::mandatory_positional_argument<std::vector<std::string>> mInputs;
 };
 
+namespace MyNS {
+struct CountedValueType {
+  static inline std::size_t sConstructions {0};
+  CountedValueType() {
+    ++sConstructions;
+  }
+};
+void from_string_argument(CountedValueType&, std::string_view) {
+}
+}// namespace MyNS
+using MyNS::CountedValueType;
+
+struct CountedArgs {
+  CountedValueType mCounted;
+  bool mFlag {false};
+};
+
+struct SharedPrefixes {
+  bool mVerbose {false};
+  bool mVerify {false};
+  std::string mOutput;
+  std::string mOutputFormat;
+};
+
+struct ShortOptions {
+  magic_args::flag mAll {.mShortName = "a"};
+  magic_args::flag mBrief {.mShortName = "b"};
+  magic_args::counted_flag mVerbose {
+    .mHelp = "more output",
+    .mShortName = "v",
+  };
+  magic_args::option<std::string> mOutput {.mShortName = "o"};
+  magic_args::optional_positional_argument<std::string> mInput;
+};
+
+struct Numbers {
+  int mInt {0};
+  unsigned int mUnsigned {0};
+  std::int8_t mSmall {0};
+  double mDouble {0};
+  magic_args::option<bool> mBool;
+  magic_args::optional_positional_argument<std::vector<int>> mValues;
+};
+
+namespace MyNS {
+struct EvenNumber {
+  int mValue {};
+};
+std::expected<void, magic_args::incomplete_parse_reason> from_string_argument(
+  EvenNumber& v,
+  std::string_view arg) {
+  if (arg.size() != 1 || ((arg.front() - '0') % 2) != 0) {
+    return std::unexpected {
+      magic_args::incomplete_parse_reason::InvalidArgumentValue};
+  }
+  v.mValue = arg.front() - '0';
+  return {};
+}
+}// namespace MyNS
+
+struct CheckedCustomArgs {
+  MyNS::EvenNumber mEven;
+};
+
+struct LazyPositionalArguments {
+  bool mFlag {false};
+  magic_args::optional_positional_argument<
+    magic_args::positional_argument_range<std::string>>
+    mPaths;
+};
+
+struct LazyNumbers {
+  magic_args::mandatory_positional_argument<
+    magic_args::positional_argument_range<int>>
+    mValues;
+};
+
+static_assert(std::ranges::random_access_range<
+              magic_args::positional_argument_range<int>>);
+
 constexpr char testName[] = "C:/Foo/Bar/my_test.exe";
 
 TEMPLATE_TEST_CASE(
@@ -432,6 +512,16 @@ TEST_CASE("options only, --foo=value") {
   CHECK(args->mDocumentedString == "abc");
 }
 
+TEST_CASE("options only, --foo=value containing separator") {
+  std::vector<std::string_view> argv {testName, "--foo=abc=def"};
+  Output out, err;
+  const auto args = magic_args::parse<OptionsOnly>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mDocumentedString == "abc=def");
+}
+
 TEST_CASE("options only, short") {
   std::vector<std::string_view> argv {
     testName,
@@ -601,6 +691,21 @@ Arguments:
 )EOF"[1]);
 }
 
+TEST_CASE("multi-value parameter after --") {
+  std::vector<std::string_view> argv {
+    testName, "--flag", "--", "out", "--flag", "in"};
+
+  Output out, err;
+  const auto args
+    = magic_args::parse<MultiValuePositionalArgument>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mFlag);
+  CHECK(args->mOutput == "out");
+  CHECK(args->mInputs == std::vector<std::string> {"--flag", "in"});
+}
+
 TEST_CASE("multi-value parameter - --help") {
   std::vector<std::string_view> argv {testName, "--help"};
 
@@ -870,6 +975,48 @@ Options:
   CHECK(args.error() == magic_args::incomplete_parse_reason::HelpRequested);
 }
 
+namespace MyNS {
+struct RuntimeNormalizationTraits : magic_args::gnu_style_parsing_traits {
+  static void normalize_option_name(std::string& name) {
+    name = std::format("runtime-{}", name);
+  }
+};
+}// namespace MyNS
+using MyNS::RuntimeNormalizationTraits;
+
+TEST_CASE("compile-time normalization") {
+  using namespace magic_args::detail;
+  STATIC_CHECK(
+    inferred_name_storage<
+      Normalization,
+      1,
+      magic_args::gnu_style_parsing_traits>.view()
+    == "em-underscore-upper-camel");
+  STATIC_CHECK(
+    inferred_name_storage<
+      Normalization,
+      1,
+      magic_args::powershell_style_parsing_traits>.view()
+    == "EmUnderscoreUpperCamel");
+  STATIC_CHECK(!constexpr_normalized_member_name<
+               Normalization,
+               1,
+               RuntimeNormalizationTraits>);
+}
+
+TEST_CASE("runtime normalization") {
+  std::vector<std::string_view> argv {testName, "--runtime-mEmUpperCamel=foo"};
+
+  Output out, err;
+  const auto args
+    = magic_args::parse<Normalization, RuntimeNormalizationTraits>(
+      argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mEmUpperCamel == "foo");
+}
+
 TEST_CASE("GNU-style verbatim names") {
   std::vector<std::string_view> argv {testName, "--help"};
 
@@ -923,3 +1070,400 @@ Options:
   -?, -Help                    show this message
 )EOF"[1]);
 }
+
+TEST_CASE("definitions are only built once") {
+  std::vector<std::string_view> argv {testName, "--flag"};
+  Output out, err;
+  REQUIRE(magic_args::parse<CountedArgs>(argv, {}, out, err).has_value());
+
+  // Only the returned struct should be constructed on later parses
+  const auto before = CountedValueType::sConstructions;
+  REQUIRE(magic_args::parse<CountedArgs>(argv, {}, out, err).has_value());
+  CHECK(CountedValueType::sConstructions == before + 1);
+  REQUIRE(magic_args::parse<CountedArgs>(argv, {}, out, err).has_value());
+  CHECK(CountedValueType::sConstructions == before + 2);
+}
+
+TEST_CASE("unambiguous prefixes") {
+  using Traits
+    = magic_args::unambiguous_prefixes<magic_args::gnu_style_parsing_traits>;
+  std::vector<std::string_view> argv {
+    testName, "--verb", "--verif", "--output=foo", "--output-f", "bar"};
+
+  Output out, err;
+  const auto args
+    = magic_args::parse<SharedPrefixes, Traits>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mVerbose);
+  CHECK(args->mVerify);
+  CHECK(args->mOutput == "foo");
+  CHECK(args->mOutputFormat == "bar");
+}
+
+TEST_CASE("ambiguous prefixes") {
+  using Traits
+    = magic_args::unambiguous_prefixes<magic_args::gnu_style_parsing_traits>;
+  const auto arg = GENERATE("--ver", "--outp=foo");
+  std::vector<std::string_view> argv {testName, arg};
+
+  Output out, err;
+  const auto args
+    = magic_args::parse<SharedPrefixes, Traits>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(args.error() == magic_args::incomplete_parse_reason::AmbiguousArgument);
+  CHECK(out.empty());
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith(
+      std::format("my_test: Ambiguous option: {}\n\nUsage: ", arg)));
+}
+
+TEST_CASE("prefixes of --help and --version") {
+  using Traits
+    = magic_args::unambiguous_prefixes<magic_args::gnu_style_parsing_traits>;
+  using enum magic_args::incomplete_parse_reason;
+  const magic_args::program_info withVersion {.mVersion = "MyApp v1.2.3"};
+
+  const auto parse = [&](std::string_view arg, const auto& help) {
+    std::vector<std::string_view> argv {testName, "--verb", arg};
+    Output out, err;
+    return magic_args::parse<SharedPrefixes, Traits>(argv, help, out, err);
+  };
+
+  SECTION("help") {
+    const auto args = parse("--he", magic_args::program_info {});
+    REQUIRE_FALSE(args.has_value());
+    CHECK(args.error() == HelpRequested);
+  }
+  SECTION("version") {
+    const auto args = parse("--vers", withVersion);
+    REQUIRE_FALSE(args.has_value());
+    CHECK(args.error() == VersionRequested);
+  }
+  SECTION("version, if there is no version") {
+    const auto args = parse("--vers", magic_args::program_info {});
+    REQUIRE_FALSE(args.has_value());
+    CHECK(args.error() == InvalidArgument);
+  }
+  SECTION("ambiguous with an option") {
+    const auto args = parse("--ver", withVersion);
+    REQUIRE_FALSE(args.has_value());
+    CHECK(args.error() == AmbiguousArgument);
+  }
+  SECTION("with a value") {
+    const auto args = parse("--he=foo", magic_args::program_info {});
+    REQUIRE_FALSE(args.has_value());
+    CHECK(args.error() == InvalidArgument);
+  }
+}
+
+TEST_CASE("prefixes are not accepted by default") {
+  std::vector<std::string_view> argv {testName, "--verb"};
+
+  Output out, err;
+  const auto args = magic_args::parse<SharedPrefixes>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(args.error() == magic_args::incomplete_parse_reason::InvalidArgument);
+}
+
+TEST_CASE("short option bundles") {
+  std::vector<std::string_view> argv {testName, "-ab", "-vvv", "in"};
+
+  Output out, err;
+  const auto args = magic_args::parse<ShortOptions>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mAll);
+  CHECK(args->mBrief);
+  CHECK(args->mVerbose == 3);
+  CHECK(args->mOutput.mValue.empty());
+  CHECK(args->mInput == "in");
+}
+
+TEST_CASE("counted flags, long") {
+  std::vector<std::string_view> argv {
+    testName, "--verbose", "-v", "--verbose"};
+
+  Output out, err;
+  const auto args = magic_args::parse<ShortOptions>(argv, {}, out, err);
+  REQUIRE(args.has_value());
+  CHECK(args->mVerbose == 3);
+}
+
+TEST_CASE("short option bundles with values") {
+  auto [arg, next, consumedNext] = GENERATE(
+    std::tuple {"-vofoo", "in", false},
+    std::tuple {"-vo", "foo", true},
+    std::tuple {"-ofoo", "in", false});
+  std::vector<std::string_view> argv {testName, arg, next};
+
+  Output out, err;
+  const auto args = magic_args::parse<ShortOptions>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mOutput == "foo");
+  if (consumedNext) {
+    CHECK(args->mInput.mValue.empty());
+  } else {
+    CHECK(args->mInput == "in");
+  }
+}
+
+TEST_CASE("short option bundle missing value") {
+  std::vector<std::string_view> argv {testName, "-avo"};
+
+  Output out, err;
+  const auto args = magic_args::parse<ShortOptions>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(
+    args.error() == magic_args::incomplete_parse_reason::MissingArgumentValue);
+}
+
+TEST_CASE("short option bundle with unknown option") {
+  std::vector<std::string_view> argv {testName, "-abz"};
+
+  Output out, err;
+  const auto args = magic_args::parse<ShortOptions>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(args.error() == magic_args::incomplete_parse_reason::InvalidArgument);
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith("my_test: Unrecognized option: -abz\n"));
+}
+
+TEST_CASE("short options, --help") {
+  std::vector<std::string_view> argv {testName, "--help"};
+
+  Output out, err;
+  const auto args = magic_args::parse<ShortOptions>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(args.error() == magic_args::incomplete_parse_reason::HelpRequested);
+  CHECK(out.get() == &R"EOF(
+Usage: my_test [OPTIONS...] [--] [INPUT]
+
+Options:
+
+  -a, --all
+  -b, --brief
+  -v, --verbose                more output
+  -o, --output=VALUE
+
+  -?, --help                   show this message
+
+Arguments:
+
+      INPUT
+)EOF"[1]);
+}
+
+TEST_CASE("numeric values") {
+  std::vector<std::string_view> argv {
+    testName,
+    "--int=-123",
+    "--unsigned",
+    "+456",
+    "--small=-7",
+    "--double=1.5e3",
+    "--bool=true",
+    "1",
+    "2",
+  };
+
+  Output out, err;
+  const auto args = magic_args::parse<Numbers>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mInt == -123);
+  CHECK(args->mUnsigned == 456);
+  CHECK(args->mSmall == -7);
+  CHECK(args->mDouble == 1500.0);
+  CHECK(args->mBool.mValue);
+  CHECK(args->mValues.mValue == std::vector {1, 2});
+}
+
+TEST_CASE("invalid numeric values") {
+  const auto [arg, name, value] = GENERATE(
+    std::tuple {"--int=", "--int", ""},
+    std::tuple {"--int=abc", "--int", "abc"},
+    std::tuple {"--int=123abc", "--int", "123abc"},
+    std::tuple {"--int=99999999999", "--int", "99999999999"},
+    std::tuple {"--int=+-1", "--int", "+-1"},
+    std::tuple {"--int= 1", "--int", " 1"},
+    std::tuple {"--unsigned=-1", "--unsigned", "-1"},
+    std::tuple {"--small=128", "--small", "128"},
+    std::tuple {"--double=1.5x", "--double", "1.5x"},
+    std::tuple {"--double=1e999", "--double", "1e999"},
+    std::tuple {"--double= 1.5", "--double", " 1.5"},
+    std::tuple {"--double=-0x1p3", "--double", "-0x1p3"},
+    std::tuple {"--double=1,5", "--double", "1,5"},
+    std::tuple {"--bool=yes", "--bool", "yes"});
+  std::vector<std::string_view> argv {testName, arg};
+
+  Output out, err;
+  const auto args = magic_args::parse<Numbers>(argv, {}, out, err);
+  CHECK(out.empty());
+  REQUIRE_FALSE(args.has_value());
+  CHECK(
+    args.error() == magic_args::incomplete_parse_reason::InvalidArgumentValue);
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith(
+      std::format("my_test: Invalid value for `{}`: `{}`\n\n", name, value)));
+}
+
+TEST_CASE("invalid positional value") {
+  std::vector<std::string_view> argv {testName, "1", "two", "3"};
+
+  Output out, err;
+  const auto args = magic_args::parse<Numbers>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(
+    args.error() == magic_args::incomplete_parse_reason::InvalidArgumentValue);
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith(
+      "my_test: Invalid value for `VALUES`: `two`\n\nUsage: my_test"));
+}
+
+TEST_CASE("no arguments at all") {
+  const std::vector<std::string_view> argv;
+
+  Output out, err;
+  const auto args = magic_args::parse<FlagsOnly>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(args.error() == magic_args::incomplete_parse_reason::InvalidArgument);
+  CHECK(out.empty());
+  CHECK(err.get() == "No arguments, not even a program name\n");
+}
+
+TEST_CASE("custom arguments reporting invalid values") {
+  Output out, err;
+  std::vector<std::string_view> argv {testName, "--even=4"};
+  auto args = magic_args::parse<CheckedCustomArgs>(argv, {}, out, err);
+  REQUIRE(args.has_value());
+  CHECK(args->mEven.mValue == 4);
+
+  argv = {testName, "--even=3"};
+  args = magic_args::parse<CheckedCustomArgs>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(
+    args.error() == magic_args::incomplete_parse_reason::InvalidArgumentValue);
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith("my_test: Invalid value for `--even`: `3`\n"));
+}
+
+TEST_CASE("positional_argument_range refers to args") {
+  std::vector<std::string_view> argv {testName, "--flag", "a", "b", "c"};
+
+  Output out, err;
+  const auto args
+    = magic_args::parse<LazyPositionalArguments>(argv, {}, out, err);
+  CHECK(out.empty());
+  CHECK(err.empty());
+  REQUIRE(args.has_value());
+  CHECK(args->mFlag);
+  const auto& paths = args->mPaths.mValue;
+  REQUIRE(paths.size() == 3);
+  CHECK(paths.raw() == magic_args::argument_view {argv}.subspan(2));
+  CHECK(paths[1] == "b");
+  CHECK(
+    std::vector<std::string> {paths.begin(), paths.end()}
+    == std::vector<std::string> {"a", "b", "c"});
+
+  magic_args::dump(*args, out);
+  CHECK_THAT(
+    out.get(), Catch::Matchers::ContainsSubstring("[`a`, `b`, `c`]"));
+}
+
+TEST_CASE("positional_argument_range with options between values") {
+  std::vector<std::string_view> argv {
+    testName, "a", "--flag", "b", "--", "--c"};
+
+  Output out, err;
+  auto args = magic_args::parse<LazyPositionalArguments>(argv, {}, out, err);
+  REQUIRE(args.has_value());
+  CHECK(args->mFlag);
+  // Copy and move the range, then destroy the original
+  const auto copied = args->mPaths.mValue;
+  const auto moved = std::move(args->mPaths.mValue);
+  *args = {};
+  CHECK(
+    std::vector<std::string> {copied.begin(), copied.end()}
+    == std::vector<std::string> {"a", "b", "--c"});
+  CHECK(moved == copied);
+}
+
+TEST_CASE("positional_argument_range from argc/argv") {
+  std::string arg0 {testName}, arg1 {"12"}, arg2 {"34"};
+  std::array<char*, 3> argv {arg0.data(), arg1.data(), arg2.data()};
+
+  Output out, err;
+  const auto args = magic_args::parse<LazyNumbers>(
+    static_cast<int>(argv.size()), argv.data(), {}, out, err);
+  REQUIRE(args.has_value());
+  const auto& values = args->mValues.mValue;
+  CHECK(
+    std::vector<int> {values.begin(), values.end()} == std::vector {12, 34});
+  CHECK(values.raw().front().data() == arg1.data());
+}
+
+TEST_CASE("positional_argument_range with invalid value") {
+  std::vector<std::string_view> argv {testName, "1", "two"};
+
+  Output out, err;
+  const auto args = magic_args::parse<LazyNumbers>(argv, {}, out, err);
+  REQUIRE_FALSE(args.has_value());
+  CHECK(
+    args.error() == magic_args::incomplete_parse_reason::InvalidArgumentValue);
+  CHECK_THAT(
+    err.get(),
+    Catch::Matchers::StartsWith(
+      "my_test: Invalid value for `VALUES`: `two`\n\n"
+      "Usage: my_test [OPTIONS...] [--] VALUE [VALUE [...]]\n"));
+}
+
+TEST_CASE("std::vector<std::string> arguments") {
+  const std::vector<std::string> argv {testName, "--flag", "a", "b"};
+
+  Output out, err;
+  const auto args
+    = magic_args::parse<LazyPositionalArguments>(argv, {}, out, err);
+  REQUIRE(args.has_value());
+  CHECK(args->mFlag);
+  const auto& paths = args->mPaths.mValue;
+  REQUIRE(paths.size() == 2);
+  CHECK(paths.raw().front().data() == argv[2].data());
+  CHECK(paths[1] == "b");
+}
+
+TEST_CASE("const char* const* arguments") {
+  const char* const argv[] {testName, "12", "--", "-34"};
+
+  Output out, err;
+  const auto args = magic_args::parse<LazyNumbers>(
+    static_cast<int>(std::size(argv)), argv, {}, out, err);
+  REQUIRE(args.has_value());
+  const auto& values = args->mValues.mValue;
+  CHECK(
+    std::vector<int> {values.begin(), values.end()} == std::vector {12, -34});
+}
+
+TEST_CASE("argument_view") {
+  const char* const argv[] {"a", "bc", "def"};
+  const magic_args::argument_view view {argv};
+  REQUIRE(view.size() == 3);
+  CHECK(view[1] == "bc");
+  CHECK(view[1].data() == argv[1]);
+  CHECK(view.subspan(1).front() == "bc");
+  CHECK(view.subspan(1, 1).size() == 1);
+  CHECK(view.end() - view.begin() == 3);
+  CHECK(
+    std::vector<std::string_view> {view.begin(), view.end()}
+    == std::vector<std::string_view> {"a", "bc", "def"});
+}